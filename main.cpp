@@ -10,15 +10,65 @@
 #include "tools/Loader.h"
 #include "tools/Dumper.h"
 #include "tools/Debugger.h"
+#include "tools/WatchMemory.h"
+#include "tools/RecordingMemory.h"
 #include "tools/host_syscalls.h"
+#include "tools/CrossCompiler.h"
+#include "tools/TraceJIT.h"
+#include "tools/BatchRunner.h"
+#include "tools/BlockFile.h"
+#include "tools/FrameDecoder.h"
 
 #include "tests/Test.h"
 #include "tests/VMTests.h"
 #include "tests/SlurpTests.h"
 #include "tests/RangeTests.h"
 #include "tests/LabelTests.h"
+#include "tests/WatchTests.h"
+#include "tests/PeepholeTests.h"
+#include "tests/TokenTests.h"
+#include "tests/HeaderTests.h"
+#include "tests/ShakeTests.h"
+#include "tests/JitTests.h"
+#include "tests/BlockTests.h"
+#include "tests/SerialTests.h"
+#include "tests/FrameTests.h"
+#include "tests/TrapTests.h"
+#include "tests/StackTests.h"
+#include "tests/NativeTests.h"
+#include "tests/LineReaderTests.h"
+#include "tests/RomCacheTests.h"
+#include "tests/RecordingTests.h"
+#include "tests/FileTests.h"
+#include "tests/SourceTests.h"
+#include "tests/FormatTests.h"
 
 #define GENERATE_328P
+// Count memory accesses and report them when the VM halts
+// #define RECORD_MEMORY
+// Token-thread the straight-line colon words in ROM to save space
+// #define TOKEN_THREADED
+// Keep the ROM headers apart from the code and write a turnkey image
+// without them, plus ForthImage.sym so the Debugger can still name words
+// #define SEPARATE_HEADERS
+#define SEPARATE_HEADERS_AT 0x1400 // Past the end of the code, below #FENCE
+// The word address START runs instead of OUTER, which the turnkey image
+// needs as it has no headers for OUTER to search
+// #define BOOT_WORD "APP_WA"
+// Drop the words the boot path and the application can't reach and write
+// an image only as long as what is left. The REPL finds only these words,
+// and with BOOT_WORD set the REPL itself goes unless a root uses it
+// #define TREE_SHAKE
+// Translate the ROM code into C++ functions in ForthNative.h
+// #define WRITE_NATIVE
+// Run the functions from a previous WRITE_NATIVE build of the same image
+// #define USE_NATIVE
+// Translate hot code as it runs, see tools/TraceJIT.h
+// #define TRACE_JIT
+
+#ifdef USE_NATIVE
+#include "ForthNative.h"
+#endif
 
 /*
 * core.asm defines
@@ -26,17 +76,34 @@
 * RAMSTART 0x1000
 * RAMSIZE  0x3000
 *
-* So here we define RAM to be sized 0x4000 to hold everything
+* So here we define RAM to be sized 0x4000 to hold everything,
+* followed by the BLOCK buffers
 */
-uint8_t ram[16384];
+#define BLOCK_BUFFERS_AT 0x4000
+#define BLOCK_FILE_BLOCKS 64 // Blocks in a new -k file
+uint8_t ram[BLOCK_BUFFERS_AT + BLOCK_BUFFERS * BLOCK_SIZE];
 
 uint8_t rom[32];
 
-UnsafeMemory mem(ram, 16384, 0, rom, 64, 16384);
+UnsafeMemory mem(ram, sizeof(ram), 0, rom, 64, sizeof(ram));
+#ifdef RECORD_MEMORY
+RecordingMemory recordMem(&mem);
+WatchMemory watchMem(&recordMem);
+#else
+WatchMemory watchMem(&mem);
+#endif
+
+Syscall syscalls[SYSCALL_COUNT];
 
-Syscall syscalls[40];
+BlockFile blockFile;
+Blocks blocks(&blockFile, BLOCK_BUFFERS_AT);
 
-ForthVM vm(&mem, syscalls, 40);
+#ifdef TRACE_JIT
+TraceJIT jit(&watchMem);
+ForthVM vm(&jit, syscalls, SYSCALL_COUNT);
+#else
+ForthVM vm(&watchMem, syscalls, SYSCALL_COUNT);
+#endif
 Loader loader(&mem);
 
 Assembler fasm;
@@ -48,6 +115,24 @@ VMTests vmTests(testSuite, &vm, &fasm, &loader);
 RangeTests rangeTests(testSuite, &vm, &fasm, &loader);
 LabelTests labelTests(testSuite, &vm, &fasm, &loader);
 SlurpTests slurpTests(testSuite, &vm, &fasm, &loader);
+WatchTests watchTests(testSuite, &vm, &fasm, &loader);
+PeepholeTests peepholeTests(testSuite, &vm, &fasm, &loader);
+TokenTests tokenTests(testSuite, &vm, &fasm, &loader);
+HeaderTests headerTests(testSuite, &vm, &fasm, &loader);
+ShakeTests shakeTests(testSuite, &vm, &fasm, &loader);
+JitTests jitTests(testSuite, &vm, &fasm, &loader);
+BlockTests blockTests(testSuite, &vm, &fasm, &loader);
+SerialTests serialTests(testSuite, &vm, &fasm, &loader);
+FrameTests frameTests(testSuite, &vm, &fasm, &loader);
+TrapTests trapTests(testSuite, &vm, &fasm, &loader);
+StackTests stackTests(testSuite, &vm, &fasm, &loader);
+NativeTests nativeTests(testSuite, &vm, &fasm, &loader);
+LineReaderTests lineReaderTests(testSuite, &vm, &fasm, &loader);
+RomCacheTests romCacheTests(testSuite, &vm, &fasm, &loader);
+RecordingTests recordingTests(testSuite, &vm, &fasm, &loader);
+FileTests fileTests(testSuite, &vm, &fasm, &loader);
+SourceTests sourceTests(testSuite, &vm, &fasm, &loader);
+FormatTests formatTests(testSuite, &vm, &fasm, &loader);
 
 int tests = 0;
 int passed = 0;
@@ -57,6 +142,9 @@ bool runInstructionTests;
 bool runAssemblerTests;
 bool runGenerateTestCode;
 bool verbose;
+const char *batchScript;
+const char *blockPath;
+const char *framePath;
 
 void syscall_debug(ForthVM *vm)
 {
@@ -83,8 +171,11 @@ bool getArgs(int argc, char **argv)
   runAssemblerTests = false;
   runGenerateTestCode = false;
   verbose = false;
+  batchScript = NULL;
+  blockPath = NULL;
+  framePath = NULL;
 
-  while ((c = getopt(argc, argv, "iagv")) != -1)
+  while ((c = getopt(argc, argv, "iagvqb:k:d:")) != -1)
   {
     switch (c)
     {
@@ -100,6 +191,18 @@ bool getArgs(int argc, char **argv)
     case 'v':
       verbose = true;
       break;
+    case 'q':
+      Serial.setSink(SERIAL_SINK_NULL);
+      break;
+    case 'b':
+      batchScript = optarg;
+      break;
+    case 'k':
+      blockPath = optarg;
+      break;
+    case 'd':
+      framePath = optarg;
+      break;
     case '?':
       if (isprint(optopt))
       {
@@ -129,13 +232,31 @@ bool loadInnerInterpreter()
   fasm.setOption("#SPTOP", 0x2380);    
   fasm.setOption("#RSTOP", 0x23fe);    
 #endif
+#ifdef TOKEN_THREADED
+  fasm.setOption("#TOKENS", 1);
+#endif
+#ifdef SEPARATE_HEADERS
+  fasm.setOption("#HEADERS", SEPARATE_HEADERS_AT);
+#endif
+#ifdef BOOT_WORD
+  fasm.setBoot(BOOT_WORD);
+#endif
+#ifdef TREE_SHAKE
+  // The application's words, START brings in BOOT_WORD or else OUTER
+  fasm.addRoot("DOT");
+  fasm.addRoot("PLUS");
+  fasm.addRoot("EMIT");
+#endif
 
   fasm.slurp("fasm/core.fasm");
   fasm.pass1();
   fasm.pass2();
   fasm.pass3();
 
-  fasm.dump();
+  if (batchScript == NULL)
+  {
+    fasm.dump();
+  }
 
   return !fasm.hasErrors();
 }
@@ -146,6 +267,7 @@ void attachSyscalls()
   vm.addSyscall(SYSCALL_TYPE, syscall_type);
   vm.addSyscall(SYSCALL_TYPELN, syscall_typeln);
   vm.addSyscall(SYSCALL_DOT, syscall_dot);
+  vm.addSyscall(SYSCALL_FORMAT, syscall_format);
   vm.addSyscall(SYSCALL_GETC, syscall_getc);
   vm.addSyscall(SYSCALL_PUTC, syscall_putc);
   vm.addSyscall(SYSCALL_INLINE, syscall_inline);
@@ -162,7 +284,15 @@ void attachSyscalls()
   vm.addSyscall(SYSCALL_ARDUINO, syscall_unimplemented);
   #endif
   vm.addSyscall(SYSCALL_FREE_MEMORY, syscall_free_memory);
+  vm.addSyscall(SYSCALL_ROM_CACHE, syscall_rom_cache);
+  vm.addSyscall(SYSCALL_COMPILE, syscall_compile);
+  vm.addSyscall(SYSCALL_LITERAL, syscall_literal);
+  vm.addSyscall(SYSCALL_ISLAND, syscall_island);
+  vm.addSyscall(SYSCALL_THREADED, syscall_threaded);
   vm.addSyscall(SYSCALL_SYSCALL, syscall_syscall);
+  vm.addSyscall(SYSCALL_BLOCK, syscall_block);
+  vm.addSyscall(SYSCALL_FRAME, syscall_frame);
+  vm.addSyscall(SYSCALL_IDLE, syscall_idle);
 
   vm.addSyscall(SYSCALL_D_ADD, syscall_add_double);
   vm.addSyscall(SYSCALL_D_SUB, syscall_sub_double);
@@ -179,15 +309,65 @@ void attachSyscalls()
   vm.addSyscall(SYSCALL_FOPEN, syscall_fopen);
   vm.addSyscall(SYSCALL_FCLOSE, syscall_fclose);
   vm.addSyscall(SYSCALL_FREAD, syscall_fread);
+  vm.addSyscall(SYSCALL_FWRITE, syscall_fwrite);
+  vm.addSyscall(SYSCALL_FSEEK, syscall_fseek);
+  vm.addSyscall(SYSCALL_SOURCE, syscall_source);
   vm.addSyscall(SYSCALL_WRITE_CPP, syscall_write_cpp);
 }
 
 int main(int argc, char **argv)
 {
+  // -b script runs the script headless, - for stdin, see tools/BatchRunner.h
+  // -k file keeps the BLOCKs in file
+  // -q discards the VM's output
+  // -d file decodes the telemetry records in file, see tools/FrameDecoder.h
+  if (!getArgs(argc, argv))
+  {
+    return 2;
+  }
+  if (batchScript != NULL)
+  {
+    // Before any output, the VM's is written a block at a time
+    setvbuf(stdout, NULL, _IOFBF, BATCH_BLOCK);
+  }
+  if (framePath != NULL)
+  {
+    FrameDecoder decoder(stdout);
+    return decoder.decode(framePath) ? 0 : 1;
+  }
+  if (blockPath != NULL)
+  {
+    if (!blockFile.open(blockPath, BLOCK_FILE_BLOCKS))
+    {
+      return 2;
+    }
+    forthBlocks = &blocks;
+  }
 
-  testAssembler();
-  testRanges();
-  labelTests.run();
+  if (batchScript == NULL)
+  {
+    testAssembler();
+    testRanges();
+    labelTests.run();
+    watchTests.run();
+    peepholeTests.run();
+    tokenTests.run();
+    headerTests.run();
+    shakeTests.run();
+    jitTests.run();
+    blockTests.run();
+    serialTests.run();
+    frameTests.run();
+    trapTests.run();
+    stackTests.run();
+    nativeTests.run();
+    lineReaderTests.run();
+    romCacheTests.run();
+    recordingTests.run();
+    fileTests.run();
+    sourceTests.run();
+    formatTests.run();
+  }
   // generateTestCode();
   // testVM();
 
@@ -202,28 +382,106 @@ int main(int argc, char **argv)
 
   if (loadInnerInterpreter())
   {
-    dumper.dump(&fasm);
     fasm.writeMemory(&mem);
-    #ifdef GENERATE_328P
-    dumper.writeCPP("ForthImage_ATMEGA328.h", &fasm, &mem, 0, 8192, true);
-    #else
-    dumper.writeCPP("ForthImage_STM32F4xx.h", &fasm, &mem, 0, 8192, false);
+    uint16_t romSize = 8192;
+    #ifdef TREE_SHAKE
+    romSize = fasm.getImageEnd();
     #endif
+    if (batchScript == NULL)
+    {
+      dumper.dump(&fasm);
+      #ifdef GENERATE_328P
+      dumper.writeCPP("ForthImage_ATMEGA328.h", &fasm, &mem, 0, romSize, true);
+      #else
+      dumper.writeCPP("ForthImage_STM32F4xx.h", &fasm, &mem, 0, romSize, false);
+      #endif
+      #ifdef SEPARATE_HEADERS
+      dumper.writeTurnkeyCPP("ForthImage_Turnkey.h", &fasm, &mem, true);
+      dumper.writeSymbols("ForthImage.sym", &fasm);
+      #endif
+      #ifdef WRITE_NATIVE
+      dumper.writeNative("ForthNative.h", &fasm, &mem);
+      #endif
+    }
 
     debugger.setAssembler(&fasm);
     debugger.setVM(&vm);
+    debugger.setWatchMemory(&watchMem);
     debugger.reset();
     debugger.setBreakpoint1(0x1110);
     // debugger.setLabelBreakpoint1("STAR_UNTIL_CA");
     // debugger.setLabelBreakpoint2("TOKEN_END");
-    // ram.setWatch(0x5d4);
+    // debugger.watch(0x5d4, 0x5d6);
+    // debugger.watchSymbol("%STATE");
     // debugger.setShowForthWordsOnly();
     // debugger.setVerbose(true);
     // debugger.setBump(10);
     // debugger.writeProtect("DICTIONARY_END");
     //debugger.run();
 
+    vm.setStackBounds(fasm.getVariablesEnd(), fasm.getConstant("#SPTOP"),
+        fasm.getConstant("#SPTOP") + 2, fasm.getConstant("#RSTOP"));
+    vm.setStackTrap(fasm.getConstant("#STACK_TRAP"));
+
+    #ifdef RECORD_MEMORY
+    recordMem.addRegions(&fasm);
+    recordMem.clear();
+    #else
+    vm.setNativeStacks(fasm.getVariablesEnd(), fasm.getConstant("#SPTOP"),
+        fasm.getConstant("#SPTOP") + 2, fasm.getConstant("#RSTOP"));
+    #endif
+
+    #ifdef USE_NATIVE
+    vm.setNative(forthNative, FORTH_NATIVE_COUNT);
+    #endif
+    #ifdef TRACE_JIT
+    vm.setJit(&jit);
+    #endif
+
+    if (batchScript != NULL)
+    {
+      BatchRunner batch(&fasm, &vm);
+      if (!batch.load(batchScript))
+      {
+        return 2;
+      }
+      bool ok = batch.run();
+      blocks.save(vm.ram());
+      return ok ? 0 : 1;
+    }
+
+    if (optind < argc)
+    {
+      // Compile the Forth files given into ROM and write ForthImage.h
+      CrossCompiler cross(&fasm, &vm);
+      if (!cross.compile(argc - optind, argv + optind))
+      {
+        return 1;
+      }
+      #ifdef GENERATE_328P
+      dumper.writeCPP("ForthImage.h", &fasm, &mem, 0, romSize, true);
+      #else
+      dumper.writeCPP("ForthImage.h", &fasm, &mem, 0, romSize, false);
+      #endif
+      return 0;
+    }
+
+    watchMem.haltOnHit(&vm);
     vm.run();
+    if (watchMem.hit())
+    {
+      debugger.watchpoint(watchMem.hitPC(), true);
+    }
+    blocks.save(vm.ram());
+
+    #ifdef TRACE_JIT
+    printf("\nJIT: %u traces, %u entered, %u invalidated\n",
+        jit.translated(), jit.entered(), jit.invalidations());
+    #endif
+    #ifdef RECORD_MEMORY
+    recordMem.report(stdout);
+    recordMem.writeHeatmap("heatmap.csv");
+    #endif
   }
   else
   {
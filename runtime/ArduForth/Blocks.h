@@ -0,0 +1,161 @@
+#ifndef UKMAKER_BLOCKS_H
+#define UKMAKER_BLOCKS_H
+
+#include "FArduino.h"
+#include "ForthConfiguration.h"
+#include "Memory.h"
+
+#define BLOCK_SIZE 1024
+#define BLOCK_NONE 0xffff
+#define BLOCK_CHUNK 64
+
+/**
+ * Where the BLOCK data lives, e.g. a file on the host, or the EEPROM (see
+ * EepromStorage.h), flash or an SD card on a device. Transfers are parts
+ * of one block.
+ */
+class BlockStorage {
+
+    public:
+
+    virtual uint16_t blocks()=0;
+
+    virtual bool read(uint16_t block, uint16_t offset, uint8_t *buf, uint16_t len)=0;
+
+    virtual bool write(uint16_t block, uint16_t offset, const uint8_t *buf, uint16_t len)=0;
+
+    // Make the writes so far durable
+    virtual void sync() {}
+};
+
+/**
+ * BLOCK_BUFFERS buffers of BLOCK_SIZE bytes in VM RAM caching blocks of
+ * a BlockStorage. A block is only written back if UPDATE marked it while
+ * it was the current block, when its buffer is reused or on save().
+ *
+ * Buffers are reused round robin, never the current one, so the address
+ * BLOCK returned stays good until the next BLOCK or BUFFER.
+ */
+class Blocks {
+
+    public:
+
+    Blocks(BlockStorage *storage, uint16_t buffers) :
+        _storage(storage), _buffers(buffers), _current(0), _next(0) {
+            empty();
+        }
+    ~Blocks() {}
+
+    /**
+     * Assign a buffer to block n, reading it in if read is set
+     * @return the buffer address in VM memory, 0 if n is out of range
+     * or the storage fails
+     */
+    uint16_t block(Memory *mem, uint16_t n, bool read) {
+        if(n >= _storage->blocks()) {
+            return 0;
+        }
+        for(uint8_t i=0; i<BLOCK_BUFFERS; i++) {
+            if(_assigned[i] == n) {
+                _current = i;
+                return _address(i);
+            }
+        }
+        uint8_t i = _next;
+        if(BLOCK_BUFFERS > 1 && i == _current && _assigned[i] != BLOCK_NONE) {
+            i = (i + 1) % BLOCK_BUFFERS;
+        }
+        _next = (i + 1) % BLOCK_BUFFERS;
+        if(!_writeBack(mem, i)) {
+            return 0;
+        }
+        _assigned[i] = BLOCK_NONE;
+        if(read && !_transfer(mem, i, n, false)) {
+            return 0;
+        }
+        _assigned[i] = n;
+        _current = i;
+        return _address(i);
+    }
+
+    // Mark the current block as modified
+    void update() {
+        if(_assigned[_current] != BLOCK_NONE) {
+            _dirty[_current] = true;
+        }
+    }
+
+    // Write back the modified blocks, @return false if any failed
+    bool save(Memory *mem) {
+        bool ok = true;
+        for(uint8_t i=0; i<BLOCK_BUFFERS; i++) {
+            ok = _writeBack(mem, i) && ok;
+        }
+        _storage->sync();
+        return ok;
+    }
+
+    // Forget the buffered blocks without writing them
+    void empty() {
+        for(uint8_t i=0; i<BLOCK_BUFFERS; i++) {
+            _assigned[i] = BLOCK_NONE;
+            _dirty[i] = false;
+        }
+    }
+
+    protected:
+
+    BlockStorage *_storage;
+    uint16_t _buffers;
+    uint16_t _assigned[BLOCK_BUFFERS];
+    bool _dirty[BLOCK_BUFFERS];
+    uint8_t _current;
+    uint8_t _next;
+
+    uint16_t _address(uint8_t i) {
+        return _buffers + i * BLOCK_SIZE;
+    }
+
+    bool _writeBack(Memory *mem, uint8_t i) {
+        if(!_dirty[i]) {
+            return true;
+        }
+        if(!_transfer(mem, i, _assigned[i], true)) {
+            return false;
+        }
+        _dirty[i] = false;
+        return true;
+    }
+
+    // Move a block between buffer i and the storage, directly when the
+    // buffer can be addressed, otherwise a chunk at a time
+    bool _transfer(Memory *mem, uint8_t i, uint16_t n, bool write) {
+        uint16_t addr = _address(i);
+        if(mem->inRam(addr, BLOCK_SIZE)) {
+            uint8_t *data = mem->addressOfChar(addr);
+            return write ? _storage->write(n, 0, data, BLOCK_SIZE)
+                         : _storage->read(n, 0, data, BLOCK_SIZE);
+        }
+        uint8_t chunk[BLOCK_CHUNK];
+        for(uint16_t offset=0; offset<BLOCK_SIZE; offset+=BLOCK_CHUNK) {
+            if(write) {
+                for(uint16_t j=0; j<BLOCK_CHUNK; j++) {
+                    chunk[j] = mem->getC(addr + offset + j);
+                }
+                if(!_storage->write(n, offset, chunk, BLOCK_CHUNK)) {
+                    return false;
+                }
+            } else {
+                if(!_storage->read(n, offset, chunk, BLOCK_CHUNK)) {
+                    return false;
+                }
+                for(uint16_t j=0; j<BLOCK_CHUNK; j++) {
+                    mem->putC(addr + offset + j, chunk[j]);
+                }
+            }
+        }
+        return true;
+    }
+};
+
+#endif
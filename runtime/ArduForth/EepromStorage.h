@@ -0,0 +1,36 @@
+#ifndef UKMAKER_EEPROM_STORAGE_H
+#define UKMAKER_EEPROM_STORAGE_H
+
+#include <EEPROM.h>
+#include "Blocks.h"
+
+/**
+ * Blocks in the EEPROM, or the flash that emulates it on some cores.
+ * Kept out of Blocks.h so only a sketch that includes this pulls in
+ * the EEPROM library. Give it to a Blocks and set forthBlocks to use it.
+ */
+class EepromStorage : public BlockStorage {
+
+    public:
+
+    uint16_t blocks() {
+        return EEPROM.length() / BLOCK_SIZE;
+    }
+
+    bool read(uint16_t block, uint16_t offset, uint8_t *buf, uint16_t len) {
+        uint32_t addr = (uint32_t)block * BLOCK_SIZE + offset;
+        for(uint16_t i=0; i<len; i++) {
+            buf[i] = EEPROM.read(addr + i);
+        }
+        return true;
+    }
+
+    bool write(uint16_t block, uint16_t offset, const uint8_t *buf, uint16_t len) {
+        uint32_t addr = (uint32_t)block * BLOCK_SIZE + offset;
+        for(uint16_t i=0; i<len; i++) {
+            EEPROM.update(addr + i, buf[i]); // Only bytes that changed wear the cells
+        }
+        return true;
+    }
+};
+#endif
@@ -2,42 +2,106 @@
 #define UKMAKER_FSERIAL_H
 #include <stdio.h>
 #ifndef ARDUINO
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <poll.h>
 
 
+/**
+ * Serial port stand-in for the host. Output goes to a sink chosen at
+ * run time: stdout, a growable buffer the test harness can inspect and
+ * clear, or nowhere.
+ *
+ * Input is read from stdin in blocks, so available() can tell whether a
+ * read would wait, and wait() blocks in poll() like a device sleeping
+ * until a byte arrives. At the end of input a read returns -1 at once.
+ */
+
+#define SERIAL_IN_BLOCK 4096
+
+#define SERIAL_SINK_STDOUT 0
+#define SERIAL_SINK_BUFFER 1
+#define SERIAL_SINK_NULL 2
+
 class FSerial {
 
     public:
-    
+
+    FSerial() : _sink(SERIAL_SINK_STDOUT), _buf(NULL), _size(0), _len(0),
+        _inPos(0), _inEnd(0), _eof(false) {}
+    ~FSerial() {
+        free(_buf);
+    }
+
+    void setSink(uint8_t sink) {
+        _sink = sink;
+    }
+
+    uint8_t sink() {
+        return _sink;
+    }
+
+    // The output captured by SERIAL_SINK_BUFFER, null terminated
+    const char *captured() {
+        return _len == 0 ? "" : _buf;
+    }
+
+    size_t capturedLength() {
+        return _len;
+    }
+
+    void clearCaptured() {
+        _len = 0;
+    }
+
     int getc() {
-        return getchar();
+        return read();
     }
 
     int putc(char c) {
-        return putchar(c);
+        _emit(&c, 1);
+        return (unsigned char)c;
     }
     
     void printf(const char *format, int value) {
-        ::printf(format, value);
+        char out[16];
+        int n = snprintf(out, sizeof(out), format, value);
+        _emit(out, n < (int)sizeof(out) ? n : sizeof(out) - 1);
     }
 
     void flush() {
         // no op
     }
 
+    size_t write(const uint8_t *buf, size_t len) {
+        _emit((const char *)buf, len);
+        return len;
+    }
+
     void print(char c) {
-        putchar(c);
+        _emit(&c, 1);
     }
 
     void print(const char* s) {
-        ::printf(s, 0);
+        _emit(s, strlen(s));
     }
 
     int read() {
-        return getchar();
+        if(_inPos == _inEnd && !_fill()) {
+            return -1;
+        }
+        return (unsigned char)_in[_inPos++];
     }
 
     bool available() {
-        return true;
+        return _inPos < _inEnd || _eof || _ready(0);
+    }
+
+    // Wait up to ms for input, @return true if a read won't block
+    bool wait(uint32_t ms) {
+        return _inPos < _inEnd || _eof || _ready(ms);
     }
 
     int readBytesUntil(char separator, char *buf, size_t len) {
@@ -50,6 +114,55 @@ class FSerial {
         }
         return num_read;
     }
+
+    protected:
+
+    uint8_t _sink;
+    char *_buf;
+    size_t _size;
+    size_t _len;
+    char _in[SERIAL_IN_BLOCK];
+    size_t _inPos;
+    size_t _inEnd;
+    bool _eof;
+
+    bool _ready(int ms) {
+        struct pollfd fd = { STDIN_FILENO, POLLIN, 0 };
+        return poll(&fd, 1, ms) > 0;
+    }
+
+    bool _fill() {
+        if(_eof) {
+            return false;
+        }
+        ssize_t n = ::read(STDIN_FILENO, _in, sizeof(_in));
+        if(n <= 0) {
+            _eof = true;
+            return false;
+        }
+        _inPos = 0;
+        _inEnd = n;
+        return true;
+    }
+
+    void _emit(const char *s, size_t len) {
+        switch(_sink) {
+            case SERIAL_SINK_STDOUT:
+                fwrite(s, 1, len, stdout);
+                break;
+            case SERIAL_SINK_BUFFER:
+                if(_len + len + 1 > _size) {
+                    _size = (_len + len + 1) * 2;
+                    _buf = (char *)realloc(_buf, _size);
+                }
+                memcpy(_buf + _len, s, len);
+                _len += len;
+                _buf[_len] = '\0';
+                break;
+            default:
+                break;
+        }
+    }
 };
 
 FSerial Serial;
@@ -4,4 +4,70 @@
 #define ROM_SIZE 8192
 #define RAM_SIZE 8192
 
-#endif
\ No newline at end of file
+// Cells of each stack the VM can hold natively (see NativeStack.h)
+// 0 leaves the stacks in VM RAM
+#ifndef NATIVE_STACK_CELLS
+#ifdef ARDUINO
+#define NATIVE_STACK_CELLS 0
+#else
+#define NATIVE_STACK_CELLS 64
+#endif
+#endif
+
+// Words of ROM cached in RAM by UnsafeMemory, a power of two
+// Each takes four bytes; 0 reads ROM directly
+#ifndef ROM_CACHE_WORDS
+#ifdef ARDUINO
+#define ROM_CACHE_WORDS 0
+#else
+#define ROM_CACHE_WORDS 16
+#endif
+#endif
+
+// Run C++ translations of the ROM code from Dumper::writeNative, see
+// ForthVM::setNative. Each jump target is looked up in their table
+#ifndef VM_NATIVE
+#ifdef ARDUINO
+#define VM_NATIVE 0
+#else
+#define VM_NATIVE 1
+#endif
+#endif
+
+// Hooks for a host JIT (see tools/TraceJIT.h). Jump targets are counted
+// in JIT_HEAT_SLOTS counters and handed over at JIT_HOT landings
+#ifndef VM_JIT
+#ifdef ARDUINO
+#define VM_JIT 0
+#else
+#define VM_JIT 1
+#endif
+#endif
+#define JIT_HEAT_SLOTS 1024
+#define JIT_HOT 64
+
+// When TYPE and TYPELN wait for the serial output to drain
+// 0 never (use FLUSH), 1 after TYPELN, 2 after every TYPE
+#ifndef TYPE_FLUSH
+#define TYPE_FLUSH 1
+#endif
+#define TYPE_FLUSH_NEVER 0
+#define TYPE_FLUSH_LINE 1
+#define TYPE_FLUSH_ALWAYS 2
+
+// Stack buffer used to send ROM strings to the serial port in blocks
+#define TYPE_CHUNK 32
+
+// Bytes in the console receive ring (see LineReader.h), a power of two
+// no larger than 128, and the longest line INLINE returns
+#ifndef INLINE_RING
+#define INLINE_RING 32
+#endif
+#define INLINE_MAX 63
+
+// 1K buffers in VM RAM for BLOCK, see Blocks.h
+#ifndef BLOCK_BUFFERS
+#define BLOCK_BUFFERS 2
+#endif
+
+#endif
@@ -172,6 +172,7 @@
 #define HEADER_HEADER_BIT 15
 #define HEADER_SCOPE_BITS 13
 #define HEADER_SCOPE_MASK (0x03 << HEADER_SCOPE_BITS)
+#define HEADER_SEPARATE_BIT 12
 #define HEADER_SCOPE_NORMAL 0
 #define HEADER_SCOPE_RUNTIME 1
 #define HEADER_SCOPE_IMMEDIATE 2
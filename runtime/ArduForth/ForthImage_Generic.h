@@ -5,16 +5,28 @@
 * Constants
 *****************************/
 #define FORTH_SYSTEM 0x0000
+#define FORTH_STACK_TRAP 0x0070
 #define FORTH_INNER 0x0080
 #define FORTH_FENCE 0x1ff2
 #define FORTH_RAMSTART 0x2000
-#define FORTH_VARSTART 0x2200
-#define FORTH_SPTOP 0x2380
-#define FORTH_RSTOP 0x23fe
+#define FORTH_VARSTART 0x3000
+#define FORTH_SPTOP 0x3800
+#define FORTH_RSTOP 0x3ffe
 #define FORTH_LBUF_LEN 0x0040
+#define FORTH_FRAME_LEN 0x0030
+#define FORTH_IDLE_MS 0x000a
 #define FORTH_BASE_DEC 0x000a
 #define FORTH_BASE_HEX 0x0010
 #define FORTH_BASE_BIN 0x0002
+#define FORTH_MSG_STACK_TRAP 0x0007
+#define FORTH_TOKENS 0x0000
+#define FORTH_HEADERS 0x0000
+#define FORTH_TOKEN_EXIT 0x0000
+#define FORTH_TOKEN_ESCAPE 0x0001
+#define FORTH_TOKEN_LIT 0x0002
+#define FORTH_TOKEN_BRANCH 0x0003
+#define FORTH_TOKEN_BRANCH0 0x0004
+#define FORTH_TOKEN_FIRST 0x0005
 #define FORTH_SYSCALL_DEBUG 0x0000
 #define FORTH_SYSCALL_TYPE 0x0001
 #define FORTH_SYSCALL_TYPELN 0x0002
@@ -39,16 +51,47 @@
 #define FORTH_SYSCALL_WRITE_CPP 0x0015
 #define FORTH_SYSCALL_COMPARE 0x0016
 #define FORTH_SYSCALL_FREE_MEMORY 0x0017
-#define FORTH_SYSCALL_ARDUINO 0x0018
-#define FORTH_SYSCALL_FOPEN 0x0020
-#define FORTH_SYSCALL_FCLOSE 0x0021
-#define FORTH_SYSCALL_FREAD 0x0022
+#define FORTH_SYSCALL_SYSCALL 0x0018
+#define FORTH_SYSCALL_ARDUINO 0x0019
+#define FORTH_SYSCALL_ROM_CACHE 0x001a
+#define FORTH_SYSCALL_COMPILE 0x001b
+#define FORTH_SYSCALL_LITERAL 0x001c
+#define FORTH_SYSCALL_ISLAND 0x001d
+#define FORTH_SYSCALL_BLOCK 0x001e
+#define FORTH_SYSCALL_FORMAT 0x001f
+#define FORTH_SYSCALL_FRAME 0x0020
+#define FORTH_SYSCALL_IDLE 0x0021
+#define FORTH_SYSCALL_THREADED 0x0022
+#define FORTH_SYSCALL_FOPEN 0x0028
+#define FORTH_SYSCALL_FCLOSE 0x0029
+#define FORTH_SYSCALL_FREAD 0x002a
+#define FORTH_SYSCALL_FWRITE 0x002b
+#define FORTH_SYSCALL_FSEEK 0x002c
+#define FORTH_SYSCALL_SOURCE 0x002d
+#define FORTH_SOURCE_OPEN 0x0000
+#define FORTH_SOURCE_LINE 0x0001
+#define FORTH_SOURCE_CLOSE 0x0002
+#define FORTH_SOURCE_TOKEN 0x0003
+#define FORTH_FRAME_BEGIN 0x0000
+#define FORTH_FRAME_CELL 0x0001
+#define FORTH_FRAME_DOUBLE 0x0002
+#define FORTH_FRAME_SEND 0x0003
+#define FORTH_FORMAT_UNSIGNED 0x0001
+#define FORTH_FORMAT_DOUBLE 0x0002
+#define FORTH_FORMAT_CELL 0x0004
+#define FORTH_BLOCK_BLOCK 0x0000
+#define FORTH_BLOCK_BUFFER 0x0001
+#define FORTH_BLOCK_UPDATE 0x0002
+#define FORTH_BLOCK_SAVE 0x0003
+#define FORTH_BLOCK_EMPTY 0x0004
+#define FORTH_BLOCK_FLUSH 0x0005
 #define FORTH_MODE_EXECUTE 0x0000
 #define FORTH_MODE_COMPILE 0x0001
 #define FORTH_STATE_NOT_FOUND 0x0000
 #define FORTH_STATE_FOUND 0x0001
-#define FORTH_HEADER_MASK 0x1fff
+#define FORTH_HEADER_MASK 0x0fff
 #define FORTH_HEADER_HEADER_BIT 0x000f
+#define FORTH_HEADER_SEPARATE_BIT 0x000c
 #define FORTH_HEADER_SCOPE_BITS 0x000d
 #define FORTH_HEADER_SCOPE_NORMAL 0x0000
 #define FORTH_HEADER_SCOPE_RUNTIME 0x0001
@@ -57,406 +100,407 @@
 #define FORTH_HEADER_IMMEDIATE 0xc000
 #define FORTH_HEADER_RUNTIME 0xa000
 #define FORTH_HEADER_EXECUTIVE 0xe000
+#define FORTH_VAREND 0x30bc
 const uint8_t rom[8192] PROGMEM = {
-/* 0x0000 */ 0x80, 0x03, 0x00, 0x20, 0x90, 0x03, 0x46, 0x22, 0x98, 0x10, 0x80, 0x03, 0x72, 0x15, 0x90, 0x03, 
-/* 0x0010 */ 0x4c, 0x22, 0x98, 0x10, 0x80, 0x03, 0x4a, 0x22, 0x89, 0x10, 0x80, 0x03, 0x48, 0x22, 0x89, 0x10, 
-/* 0x0020 */ 0xd0, 0x03, 0x80, 0x23, 0xe0, 0x03, 0xfe, 0x23, 0x80, 0x03, 0x06, 0x22, 0x90, 0x03, 0x04, 0x22, 
-/* 0x0030 */ 0x98, 0x10, 0x80, 0x03, 0x10, 0x00, 0x90, 0x03, 0x00, 0x22, 0x98, 0x10, 0x80, 0x03, 0x00, 0x00, 
-/* 0x0040 */ 0x90, 0x03, 0x4e, 0x22, 0x98, 0x10, 0x80, 0x03, 0x00, 0x00, 0x90, 0x03, 0x50, 0x22, 0x98, 0x10, 
-/* 0x0050 */ 0x80, 0x03, 0x0a, 0x00, 0x90, 0x03, 0x00, 0x22, 0x98, 0x10, 0xa0, 0x03, 0x52, 0x0f, 0x00, 0x80, 
-/* 0x0060 */ 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x0070 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+/* 0x0000 */ 0x80, 0x03, 0x00, 0x20, 0x90, 0x03, 0x46, 0x30, 0x98, 0x10, 0x80, 0x03, 0xf2, 0x1f, 0x90, 0x03, 
+/* 0x0010 */ 0x4c, 0x30, 0x98, 0x10, 0x80, 0x03, 0x4a, 0x30, 0x89, 0x10, 0x80, 0x03, 0x48, 0x30, 0x89, 0x10, 
+/* 0x0020 */ 0x00, 0x80, 0x10, 0x02, 0xd0, 0x03, 0x00, 0x38, 0xe0, 0x03, 0xfe, 0x3f, 0x80, 0x03, 0x06, 0x30, 
+/* 0x0030 */ 0x90, 0x03, 0x04, 0x30, 0x98, 0x10, 0x80, 0x03, 0x10, 0x00, 0x90, 0x03, 0x00, 0x30, 0x98, 0x10, 
+/* 0x0040 */ 0x80, 0x03, 0x00, 0x00, 0x90, 0x03, 0x4e, 0x30, 0x98, 0x10, 0x80, 0x03, 0x00, 0x00, 0x90, 0x03, 
+/* 0x0050 */ 0x50, 0x30, 0x98, 0x10, 0x80, 0x03, 0x0a, 0x00, 0x90, 0x03, 0x00, 0x30, 0x98, 0x10, 0x80, 0x02, 
+/* 0x0060 */ 0x90, 0x03, 0x64, 0x30, 0x98, 0x10, 0xa0, 0x03, 0x34, 0x02, 0x00, 0x80, 0x8a, 0x00, 0x00, 0x00, 
+/* 0x0070 */ 0xa0, 0x03, 0x88, 0x03, 0x00, 0x80, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 /* 0x0080 */ 0xa0, 0x1a, 0xac, 0x01, 0x02, 0x81, 0x88, 0x00, 0xa0, 0x1c, 0xca, 0x06, 0xa2, 0x1e, 0xbc, 0x06, 
-/* 0x0090 */ 0xc2, 0x1e, 0xfb, 0x01, 0x16, 0x00, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x21, 0x20, 0x49, 0x27, 0x6d, 
-/* 0x00a0 */ 0x20, 0x61, 0x20, 0x54, 0x49, 0x4c, 0x20, 0x3a, 0x2d, 0x29, 0x20, 0x3e, 0x0e, 0x00, 0x55, 0x6e, 
-/* 0x00b0 */ 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x20, 0x27, 0x00, 0x43, 0x6f, 
-/* 0x00c0 */ 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x73, 
-/* 0x00d0 */ 0x20, 0x66, 0x6f, 0x72, 0x62, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 0x61, 0x74, 0x20, 0x72, 0x75, 
-/* 0x00e0 */ 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x00, 0x27, 0x00, 0x52, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x20, 
-/* 0x00f0 */ 0x77, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x62, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 
-/* 0x0100 */ 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x00, 
-/* 0x0110 */ 0x0c, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0e, 0x00, 
-/* 0x0120 */ 0x57, 0x6f, 0x72, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x06, 0x00, 
-/* 0x0130 */ 0x20, 0x4f, 0x4b, 0x20, 0x3e, 0x3e, 0x0f, 0x00, 0x53, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x75, 0x6e, 
-/* 0x0140 */ 0x64, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x00, 0x16, 0x00, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 
-/* 0x0150 */ 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 
-/* 0x0160 */ 0x07, 0x80, 0x3c, 0x42, 0x55, 0x49, 0x4c, 0x44, 0x53, 0x00, 0x00, 0x00, 0x80, 0x00, 0x9c, 0x0c, 
-/* 0x0170 */ 0x00, 0x00, 0xe6, 0x0a, 0x86, 0x00, 0x05, 0x80, 0x44, 0x4f, 0x45, 0x53, 0x3e, 0x00, 0x60, 0x01, 
-/* 0x0180 */ 0x80, 0x00, 0xae, 0x08, 0xd2, 0x08, 0x7c, 0x09, 0xd8, 0x03, 0xa0, 0x08, 0xa0, 0x1a, 0xac, 0x06, 
-/* 0x0190 */ 0xc2, 0x1e, 0xc0, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x09, 0x80, 0x49, 0x4d, 0x4d, 0x45, 0x44, 0x49, 
-/* 0x01a0 */ 0x41, 0x54, 0x45, 0x00, 0x76, 0x01, 0xa8, 0x01, 0x80, 0x03, 0x4a, 0x22, 0x98, 0x06, 0x99, 0x06, 
-/* 0x01b0 */ 0x89, 0x06, 0x00, 0x03, 0x00, 0xc0, 0x80, 0x2a, 0x98, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 
-/* 0x01c0 */ 0x52, 0x55, 0x4e, 0x54, 0x49, 0x4d, 0x45, 0x00, 0x98, 0x01, 0xcc, 0x01, 0x80, 0x03, 0x4a, 0x22, 
-/* 0x01d0 */ 0x98, 0x06, 0x99, 0x06, 0x89, 0x06, 0x00, 0x03, 0x00, 0xa0, 0x80, 0x2a, 0x98, 0x10, 0x00, 0x80, 
-/* 0x01e0 */ 0x8a, 0x00, 0x09, 0x80, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x49, 0x56, 0x45, 0x00, 0xbe, 0x01, 
-/* 0x01f0 */ 0xf2, 0x01, 0x80, 0x03, 0x4a, 0x22, 0x98, 0x06, 0x99, 0x06, 0x89, 0x06, 0x00, 0x03, 0x00, 0xe0, 
-/* 0x0200 */ 0x80, 0x2a, 0x98, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x0a, 0x80, 0x56, 0x4f, 0x43, 0x41, 0x42, 0x55, 
-/* 0x0210 */ 0x4c, 0x41, 0x52, 0x59, 0xe2, 0x01, 0x80, 0x00, 0x6c, 0x01, 0xd2, 0x08, 0x10, 0x08, 0x80, 0x01, 
-/* 0x0220 */ 0x8a, 0x0a, 0xd8, 0x03, 0x86, 0x00, 0x04, 0x80, 0x43, 0x4f, 0x44, 0x45, 0x08, 0x02, 0x30, 0x02, 
-/* 0x0230 */ 0x80, 0x03, 0x4c, 0x22, 0x90, 0x03, 0x48, 0x22, 0x98, 0x06, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 
-/* 0x0240 */ 0x2a, 0x22, 0x26, 0x02, 0x46, 0x02, 0x8a, 0x06, 0xa0, 0x19, 0x01, 0x45, 0xa8, 0x1d, 0xa3, 0x1e, 
-/* 0x0250 */ 0xa0, 0x3e, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x44, 0x45, 0x42, 0x55, 0x47, 0x00, 0x3e, 0x02, 
-/* 0x0260 */ 0x62, 0x02, 0x00, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 0x52, 0x45, 0x53, 0x54, 0x41, 0x52, 
-/* 0x0270 */ 0x54, 0x00, 0x56, 0x02, 0x20, 0x00, 0x06, 0x80, 0x2a, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x68, 0x02, 
-/* 0x0280 */ 0x82, 0x02, 0x00, 0x03, 0x80, 0x23, 0x0d, 0x22, 0x06, 0xb1, 0xd0, 0x03, 0x80, 0x23, 0x80, 0x03, 
-/* 0x0290 */ 0x36, 0x01, 0x80, 0x19, 0x02, 0x45, 0x00, 0x03, 0xfe, 0x23, 0x0e, 0x22, 0x06, 0xb1, 0x80, 0x03, 
-/* 0x02a0 */ 0x48, 0x01, 0x80, 0x19, 0x02, 0x45, 0x00, 0x80, 0x20, 0x00, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 
-/* 0x02b0 */ 0x54, 0x59, 0x50, 0x45, 0x76, 0x02, 0xb8, 0x02, 0x01, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 
-/* 0x02c0 */ 0x54, 0x59, 0x50, 0x45, 0x4c, 0x4e, 0xae, 0x02, 0xca, 0x02, 0x02, 0x45, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x02d0 */ 0x04, 0x80, 0x45, 0x4d, 0x49, 0x54, 0xbe, 0x02, 0xda, 0x02, 0x05, 0x45, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x02e0 */ 0x07, 0x80, 0x4d, 0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x00, 0xd0, 0x02, 0xee, 0x02, 0x80, 0x1b, 
-/* 0x02f0 */ 0x90, 0x03, 0x94, 0x00, 0x88, 0x29, 0x06, 0xa5, 0x09, 0x06, 0x90, 0x1d, 0x93, 0x1e, 0x90, 0x3e, 
-/* 0x0300 */ 0x8f, 0x1e, 0xf8, 0x81, 0x90, 0x19, 0x01, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x2e, 0x00, 
-/* 0x0310 */ 0xe0, 0x02, 0x14, 0x03, 0x80, 0x03, 0x00, 0x22, 0x98, 0x06, 0x90, 0x19, 0x03, 0x45, 0x00, 0x80, 
-/* 0x0320 */ 0x8a, 0x00, 0x02, 0x80, 0x2e, 0x43, 0x0c, 0x03, 0x2a, 0x03, 0x80, 0x03, 0x00, 0x22, 0x98, 0x06, 
-/* 0x0330 */ 0x90, 0x19, 0x14, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x4d, 0x4f, 0x44, 0x45, 0x22, 0x03, 
-/* 0x0340 */ 0x42, 0x03, 0x80, 0x03, 0x4e, 0x22, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x42, 0x41, 
-/* 0x0350 */ 0x53, 0x45, 0x38, 0x03, 0x56, 0x03, 0x80, 0x03, 0x00, 0x22, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x0360 */ 0x03, 0x80, 0x48, 0x45, 0x58, 0x00, 0x4c, 0x03, 0x6a, 0x03, 0x80, 0x03, 0x00, 0x22, 0x10, 0x05, 
-/* 0x0370 */ 0x89, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 0x44, 0x45, 0x43, 0x49, 0x4d, 0x41, 0x4c, 0x00, 
-/* 0x0380 */ 0x60, 0x03, 0x84, 0x03, 0x80, 0x03, 0x00, 0x22, 0x0a, 0x05, 0x89, 0x10, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x0390 */ 0x06, 0x80, 0x42, 0x49, 0x4e, 0x41, 0x52, 0x59, 0x76, 0x03, 0x9c, 0x03, 0x80, 0x03, 0x00, 0x22, 
-/* 0x03a0 */ 0x02, 0x05, 0x89, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x40, 0x00, 0x90, 0x03, 0xb0, 0x03, 
-/* 0x03b0 */ 0x80, 0x1b, 0x88, 0x06, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x43, 0x40, 0xa8, 0x03, 
-/* 0x03c0 */ 0xc2, 0x03, 0x80, 0x1b, 0x98, 0x06, 0x80, 0x03, 0xff, 0x00, 0x98, 0x29, 0x90, 0x19, 0x00, 0x80, 
-/* 0x03d0 */ 0x8a, 0x00, 0x01, 0x80, 0x21, 0x00, 0xba, 0x03, 0xda, 0x03, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x10, 
-/* 0x03e0 */ 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x48, 0x40, 0xd2, 0x03, 0xec, 0x03, 0x09, 0x45, 0x00, 0x80, 
-/* 0x03f0 */ 0x8a, 0x00, 0x02, 0x80, 0x48, 0x21, 0xe4, 0x03, 0xfa, 0x03, 0x0a, 0x45, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x0400 */ 0x02, 0x80, 0x44, 0x40, 0xf2, 0x03, 0x08, 0x04, 0x00, 0x1b, 0x10, 0x06, 0x02, 0x1e, 0x20, 0x06, 
-/* 0x0410 */ 0x10, 0x19, 0x20, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x44, 0x21, 0x00, 0x04, 0x20, 0x04, 
-/* 0x0420 */ 0x00, 0x1b, 0x10, 0x1b, 0x20, 0x1b, 0x02, 0x10, 0x02, 0x1e, 0x01, 0x10, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x0430 */ 0x02, 0x80, 0x44, 0x2b, 0x18, 0x04, 0x38, 0x04, 0x0b, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 
-/* 0x0440 */ 0x44, 0x41, 0x4e, 0x44, 0x30, 0x04, 0x48, 0x04, 0x11, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 
-/* 0x0450 */ 0x44, 0x4f, 0x52, 0x00, 0x3e, 0x04, 0x58, 0x04, 0x12, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 
-/* 0x0460 */ 0x44, 0x49, 0x4e, 0x56, 0x45, 0x52, 0x54, 0x00, 0x4e, 0x04, 0x6c, 0x04, 0x13, 0x45, 0x00, 0x80, 
-/* 0x0470 */ 0x8a, 0x00, 0x02, 0x80, 0x44, 0x2d, 0x5e, 0x04, 0x7a, 0x04, 0x0c, 0x45, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x0480 */ 0x02, 0x80, 0x44, 0x2a, 0x72, 0x04, 0x88, 0x04, 0x0d, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 
-/* 0x0490 */ 0x44, 0x2f, 0x80, 0x04, 0x96, 0x04, 0x0e, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x44, 0x3e, 
-/* 0x04a0 */ 0x3e, 0x00, 0x8e, 0x04, 0xa6, 0x04, 0x0f, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x44, 0x3c, 
-/* 0x04b0 */ 0x3c, 0x00, 0x9c, 0x04, 0xb6, 0x04, 0x10, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x44, 0x53, 
-/* 0x04c0 */ 0x57, 0x41, 0x50, 0x00, 0xac, 0x04, 0xc8, 0x04, 0x00, 0x1b, 0x10, 0x1b, 0x20, 0x1b, 0x30, 0x1b, 
-/* 0x04d0 */ 0x10, 0x19, 0x00, 0x19, 0x30, 0x19, 0x20, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x44, 0x44, 
-/* 0x04e0 */ 0x55, 0x50, 0xbc, 0x04, 0xe6, 0x04, 0x00, 0x1b, 0x10, 0x1b, 0x10, 0x19, 0x00, 0x19, 0x10, 0x19, 
-/* 0x04f0 */ 0x00, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x2b, 0x00, 0xdc, 0x04, 0xfe, 0x04, 0x80, 0x1b, 
-/* 0x0500 */ 0x90, 0x1b, 0x89, 0x1d, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x2b, 0x21, 0xf6, 0x04, 
-/* 0x0510 */ 0x12, 0x05, 0x80, 0x1b, 0x90, 0x1b, 0x08, 0x06, 0x09, 0x1d, 0x80, 0x10, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x0520 */ 0x01, 0x80, 0x2d, 0x00, 0x0a, 0x05, 0x28, 0x05, 0x80, 0x1b, 0x90, 0x1b, 0x98, 0x22, 0x90, 0x19, 
-/* 0x0530 */ 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x2a, 0x00, 0x20, 0x05, 0x3c, 0x05, 0x80, 0x1b, 0x90, 0x1b, 
-/* 0x0540 */ 0x98, 0x27, 0x90, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x2f, 0x00, 0x34, 0x05, 0x50, 0x05, 
-/* 0x0550 */ 0x80, 0x1b, 0x90, 0x1b, 0x98, 0x28, 0x90, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x41, 0x4e, 
-/* 0x0560 */ 0x44, 0x00, 0x48, 0x05, 0x66, 0x05, 0x80, 0x1b, 0x90, 0x1b, 0x98, 0x29, 0x90, 0x19, 0x00, 0x80, 
-/* 0x0570 */ 0x8a, 0x00, 0x02, 0x80, 0x4f, 0x52, 0x5c, 0x05, 0x7a, 0x05, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x2a, 
-/* 0x0580 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x4e, 0x4f, 0x54, 0x00, 0x72, 0x05, 0x90, 0x05, 
-/* 0x0590 */ 0x80, 0x1b, 0x80, 0x40, 0x04, 0xa5, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x81, 0x02, 
-/* 0x05a0 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x49, 0x4e, 0x56, 0x45, 0x52, 0x54, 0x86, 0x05, 
-/* 0x05b0 */ 0xb2, 0x05, 0x80, 0x1b, 0x80, 0x2b, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x3d, 0x00, 
-/* 0x05c0 */ 0xa6, 0x05, 0xc4, 0x05, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x3f, 0x04, 0xb5, 0x81, 0x02, 0x80, 0x19, 
-/* 0x05d0 */ 0x00, 0x80, 0x8a, 0x00, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x21, 0x3d, 
-/* 0x05e0 */ 0xbc, 0x05, 0xe4, 0x05, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x3f, 0x04, 0xb5, 0x80, 0x02, 0x80, 0x19, 
-/* 0x05f0 */ 0x00, 0x80, 0x8a, 0x00, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x3e, 0x00, 
-/* 0x0600 */ 0xdc, 0x05, 0x04, 0x06, 0x80, 0x1b, 0x90, 0x1b, 0x0d, 0x81, 0x02, 0x80, 0x3e, 0x3d, 0xfc, 0x05, 
-/* 0x0610 */ 0x12, 0x06, 0x80, 0x1b, 0x90, 0x1b, 0x1f, 0x81, 0x01, 0x80, 0x3c, 0x00, 0x0a, 0x06, 0x20, 0x06, 
-/* 0x0620 */ 0x90, 0x1b, 0x80, 0x1b, 0x89, 0x3f, 0x09, 0xa5, 0x08, 0x01, 0x09, 0x2c, 0x0f, 0x3c, 0x03, 0xa5, 
-/* 0x0630 */ 0x8f, 0x3c, 0x03, 0xa5, 0x06, 0x81, 0x89, 0x3f, 0x04, 0xa1, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 
-/* 0x0640 */ 0x8a, 0x00, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x3c, 0x3d, 0x18, 0x06, 
-/* 0x0650 */ 0x52, 0x06, 0x90, 0x1b, 0x80, 0x1b, 0x89, 0x3f, 0xf4, 0xa5, 0xe6, 0x81, 0x02, 0x80, 0x55, 0x3c, 
-/* 0x0660 */ 0x4a, 0x06, 0x64, 0x06, 0x90, 0x1b, 0x80, 0x1b, 0x89, 0x3f, 0x04, 0xa1, 0x80, 0x02, 0x80, 0x19, 
-/* 0x0670 */ 0x00, 0x80, 0x8a, 0x00, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x55, 0x3e, 
-/* 0x0680 */ 0x5c, 0x06, 0x84, 0x06, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x3f, 0x04, 0xa1, 0x80, 0x02, 0x80, 0x19, 
-/* 0x0690 */ 0x00, 0x80, 0x8a, 0x00, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x30, 0x3d, 
-/* 0x06a0 */ 0x7c, 0x06, 0xa4, 0x06, 0x80, 0x1b, 0x80, 0x40, 0x04, 0xa5, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 
-/* 0x06b0 */ 0x8a, 0x00, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x31, 0x3d, 0x9c, 0x06, 
-/* 0x06c0 */ 0xc2, 0x06, 0x80, 0x1b, 0x81, 0x40, 0x04, 0xa5, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x06d0 */ 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x30, 0x3d, 0x7c, 0x06, 0xe0, 0x06, 
-/* 0x06e0 */ 0x80, 0x1b, 0x82, 0x40, 0x04, 0xa5, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x81, 0x02, 
-/* 0x06f0 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x3c, 0x3c, 0xd8, 0x06, 0xfe, 0x06, 0x90, 0x1b, 
-/* 0x0700 */ 0x80, 0x1b, 0x89, 0x2d, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x3e, 0x3e, 0xf6, 0x06, 
-/* 0x0710 */ 0x12, 0x07, 0x90, 0x1b, 0x80, 0x1b, 0x89, 0x2e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 
-/* 0x0720 */ 0x41, 0x4c, 0x49, 0x47, 0x4e, 0x00, 0x0a, 0x07, 0x2a, 0x07, 0x80, 0x1b, 0x81, 0x1e, 0x80, 0x3e, 
-/* 0x0730 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x44, 0x55, 0x50, 0x00, 0x1e, 0x07, 0x40, 0x07, 
-/* 0x0740 */ 0x80, 0x1b, 0x80, 0x19, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x52, 0x4f, 0x54, 0x00, 
-/* 0x0750 */ 0x36, 0x07, 0x54, 0x07, 0x30, 0x1b, 0x20, 0x1b, 0x10, 0x1b, 0x20, 0x19, 0x30, 0x19, 0x10, 0x19, 
-/* 0x0760 */ 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x4c, 0x52, 0x4f, 0x54, 0x4a, 0x07, 0x6e, 0x07, 0x30, 0x1b, 
-/* 0x0770 */ 0x20, 0x1b, 0x10, 0x1b, 0x30, 0x19, 0x10, 0x19, 0x20, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 
-/* 0x0780 */ 0x50, 0x49, 0x43, 0x4b, 0x64, 0x07, 0x88, 0x07, 0x00, 0x1b, 0x1d, 0x01, 0x10, 0x1d, 0x10, 0x1d, 
-/* 0x0790 */ 0x12, 0x1e, 0x21, 0x06, 0x20, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x53, 0x57, 0x41, 0x50, 
-/* 0x07a0 */ 0x7e, 0x07, 0xa4, 0x07, 0x00, 0x1b, 0x10, 0x1b, 0x00, 0x19, 0x10, 0x19, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x07b0 */ 0x04, 0x80, 0x44, 0x52, 0x4f, 0x50, 0x9a, 0x07, 0xba, 0x07, 0x80, 0x1b, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x07c0 */ 0x04, 0x80, 0x4f, 0x56, 0x45, 0x52, 0xb0, 0x07, 0xca, 0x07, 0x80, 0x1b, 0x90, 0x1b, 0x90, 0x19, 
-/* 0x07d0 */ 0x80, 0x19, 0x90, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x49, 0x00, 0xc0, 0x07, 0xe0, 0x07, 
-/* 0x07e0 */ 0x80, 0x1c, 0x80, 0x1a, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x4a, 0x00, 0xd8, 0x07, 
-/* 0x07f0 */ 0xf2, 0x07, 0xe3, 0x08, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x4b, 0x00, 0xea, 0x07, 
-/* 0x0800 */ 0x02, 0x08, 0xe5, 0x08, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x2c, 0x00, 0xfa, 0x07, 
-/* 0x0810 */ 0x12, 0x08, 0x80, 0x1b, 0x90, 0x03, 0x46, 0x22, 0x99, 0x06, 0x98, 0x10, 0x92, 0x1e, 0x80, 0x03, 
-/* 0x0820 */ 0x46, 0x22, 0x89, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x46, 0x4c, 0x55, 0x53, 0x48, 0x00, 
-/* 0x0830 */ 0x0a, 0x08, 0x34, 0x08, 0x07, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x41, 0x53, 0x50, 0x41, 
-/* 0x0840 */ 0x43, 0x45, 0x28, 0x08, 0x46, 0x08, 0x20, 0x04, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 
-/* 0x0850 */ 0x31, 0x2b, 0x3a, 0x08, 0x56, 0x08, 0x80, 0x1b, 0x81, 0x1e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x0860 */ 0x02, 0x80, 0x32, 0x2b, 0x4e, 0x08, 0x68, 0x08, 0x80, 0x1b, 0x82, 0x1e, 0x80, 0x19, 0x00, 0x80, 
-/* 0x0870 */ 0x8a, 0x00, 0x02, 0x80, 0x31, 0x2d, 0x60, 0x08, 0x7a, 0x08, 0x80, 0x1b, 0x8f, 0x1e, 0x80, 0x19, 
-/* 0x0880 */ 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x32, 0x2d, 0x72, 0x08, 0x8c, 0x08, 0x80, 0x1b, 0x8e, 0x1e, 
-/* 0x0890 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x53, 0x43, 0x4f, 0x44, 0x45, 0x00, 0x84, 0x08, 
-/* 0x08a0 */ 0x80, 0x00, 0xae, 0x08, 0xba, 0x0a, 0x86, 0x00, 0x02, 0x80, 0x52, 0x3e, 0x96, 0x08, 0xb0, 0x08, 
-/* 0x08b0 */ 0x80, 0x1c, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x3e, 0x52, 0xa8, 0x08, 0xc0, 0x08, 
-/* 0x08c0 */ 0x80, 0x1b, 0x80, 0x1a, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x45, 0x4e, 0x54, 0x52, 0x59, 0x00, 
-/* 0x08d0 */ 0xb8, 0x08, 0x80, 0x00, 0x72, 0x0a, 0xae, 0x03, 0xae, 0x03, 0x86, 0x00, 0x02, 0x80, 0x44, 0x50, 
-/* 0x08e0 */ 0xc8, 0x08, 0xe4, 0x08, 0x80, 0x03, 0x46, 0x22, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 
-/* 0x08f0 */ 0x44, 0x50, 0x21, 0x00, 0xdc, 0x08, 0xf8, 0x08, 0x80, 0x03, 0x46, 0x22, 0x90, 0x1b, 0x89, 0x10, 
-/* 0x0900 */ 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x4c, 0x42, 0x55, 0x46, 0xee, 0x08, 0x0e, 0x09, 0x80, 0x03, 
-/* 0x0910 */ 0x02, 0x22, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x32, 0x2b, 0x04, 0x09, 0x20, 0x09, 
-/* 0x0920 */ 0x80, 0x1b, 0x82, 0x1e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x57, 0x41, 0x3e, 0x4c, 
-/* 0x0930 */ 0x41, 0x00, 0x18, 0x09, 0x36, 0x09, 0x80, 0x1b, 0x98, 0x01, 0x89, 0x06, 0x00, 0x03, 0xff, 0x1f, 
-/* 0x0940 */ 0x80, 0x29, 0x89, 0x1d, 0x83, 0x1e, 0x80, 0x3e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 
-/* 0x0950 */ 0x57, 0x41, 0x3e, 0x43, 0x41, 0x00, 0x2a, 0x09, 0x5a, 0x09, 0x80, 0x1b, 0x98, 0x01, 0x89, 0x06, 
-/* 0x0960 */ 0x00, 0x03, 0xff, 0x1f, 0x80, 0x29, 0x89, 0x1d, 0x85, 0x1e, 0x80, 0x3e, 0x80, 0x19, 0x00, 0x80, 
-/* 0x0970 */ 0x8a, 0x00, 0x05, 0x80, 0x57, 0x41, 0x3e, 0x43, 0x42, 0x00, 0x4e, 0x09, 0x7e, 0x09, 0x80, 0x1b, 
-/* 0x0980 */ 0x98, 0x01, 0x89, 0x06, 0x00, 0x03, 0xff, 0x1f, 0x80, 0x29, 0x89, 0x1d, 0x87, 0x1e, 0x80, 0x3e, 
-/* 0x0990 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x43, 0x41, 0x3e, 0x57, 0x41, 0x00, 0x72, 0x09, 
-/* 0x09a0 */ 0x80, 0x00, 0x9c, 0x0c, 0x02, 0x00, 0x26, 0x05, 0x9c, 0x0c, 0x40, 0x00, 0xa2, 0x07, 0xa2, 0x07, 
-/* 0x09b0 */ 0x3e, 0x07, 0x9c, 0x0c, 0x00, 0x00, 0xc2, 0x05, 0x8e, 0x05, 0x4c, 0x0e, 0xea, 0x09, 0x9c, 0x0c, 
-/* 0x09c0 */ 0x01, 0x00, 0x26, 0x05, 0xa2, 0x07, 0x9c, 0x0c, 0x02, 0x00, 0x26, 0x05, 0x3e, 0x07, 0xae, 0x03, 
-/* 0x09d0 */ 0x9c, 0x0c, 0x00, 0x80, 0x64, 0x05, 0x4c, 0x0e, 0xe2, 0x09, 0x9c, 0x0c, 0x01, 0x00, 0x64, 0x0e, 
-/* 0x09e0 */ 0xe6, 0x09, 0x9c, 0x0c, 0x00, 0x00, 0x64, 0x0e, 0x08, 0x0a, 0xb8, 0x07, 0xb8, 0x07, 0x9c, 0x0c, 
-/* 0x09f0 */ 0x00, 0x00, 0x44, 0x02, 0x0d, 0x00, 0x2d, 0x2d, 0x20, 0x55, 0x4e, 0x4b, 0x4e, 0x4f, 0x57, 0x4e, 
-/* 0x0a00 */ 0x20, 0x2d, 0x2d, 0x00, 0x9c, 0x0c, 0x00, 0x00, 0xf0, 0x0c, 0xae, 0x09, 0xa2, 0x07, 0xb8, 0x07, 
-/* 0x0a10 */ 0x86, 0x00, 0x06, 0x80, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x96, 0x09, 0x80, 0x00, 0xd2, 0x08, 
-/* 0x0a20 */ 0x44, 0x08, 0x10, 0x0c, 0xcc, 0x0a, 0x72, 0x0a, 0xae, 0x03, 0xd8, 0x03, 0x3e, 0x07, 0x9c, 0x0c, 
-/* 0x0a30 */ 0x00, 0x80, 0x78, 0x05, 0xcc, 0x0a, 0xd8, 0x03, 0xcc, 0x0a, 0xfc, 0x04, 0x1e, 0x09, 0x28, 0x07, 
-/* 0x0a40 */ 0xe2, 0x08, 0xd8, 0x03, 0x10, 0x08, 0xcc, 0x0a, 0x1e, 0x09, 0x10, 0x08, 0x86, 0x00, 0x01, 0xe0, 
-/* 0x0a50 */ 0x3b, 0x00, 0x12, 0x0a, 0x80, 0x00, 0x9c, 0x0c, 0x86, 0x00, 0x10, 0x08, 0x9c, 0x0c, 0x00, 0x00, 
-/* 0x0a60 */ 0x40, 0x03, 0xd8, 0x03, 0x86, 0x00, 0x07, 0x80, 0x43, 0x55, 0x52, 0x52, 0x45, 0x4e, 0x54, 0x00, 
-/* 0x0a70 */ 0x4e, 0x0a, 0x74, 0x0a, 0x80, 0x03, 0x4a, 0x22, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 
-/* 0x0a80 */ 0x43, 0x4f, 0x4e, 0x54, 0x45, 0x58, 0x54, 0x00, 0x66, 0x0a, 0x8c, 0x0a, 0x80, 0x03, 0x48, 0x22, 
-/* 0x0a90 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x0b, 0x80, 0x44, 0x45, 0x46, 0x49, 0x4e, 0x49, 0x54, 0x49, 
-/* 0x0aa0 */ 0x4f, 0x4e, 0x53, 0x00, 0x7e, 0x0a, 0x80, 0x00, 0x8a, 0x0a, 0xae, 0x03, 0x72, 0x0a, 0xd8, 0x03, 
-/* 0x0ab0 */ 0x86, 0x00, 0x03, 0x80, 0x43, 0x41, 0x21, 0x00, 0x96, 0x0a, 0x80, 0x00, 0xd2, 0x08, 0x58, 0x09, 
-/* 0x0ac0 */ 0xd8, 0x03, 0x86, 0x00, 0x04, 0x80, 0x48, 0x45, 0x52, 0x45, 0xb2, 0x0a, 0xce, 0x0a, 0x80, 0x03, 
-/* 0x0ad0 */ 0x46, 0x22, 0x98, 0x06, 0x90, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x08, 0x80, 0x43, 0x4f, 0x4e, 0x53, 
-/* 0x0ae0 */ 0x54, 0x41, 0x4e, 0x54, 0xc4, 0x0a, 0x80, 0x00, 0x1c, 0x0a, 0x10, 0x08, 0xa0, 0x08, 0x8c, 0x06, 
-/* 0x0af0 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x0e, 0x80, 0x48, 0x45, 0x41, 0x44, 0x45, 0x52, 0x2d, 0x54, 
-/* 0x0b00 */ 0x4f, 0x2d, 0x4d, 0x4f, 0x44, 0x45, 0xda, 0x0a, 0x0a, 0x0b, 0x80, 0x1b, 0x90, 0x03, 0x0f, 0x00, 
-/* 0x0b10 */ 0x89, 0x35, 0x90, 0x03, 0x0d, 0x00, 0x89, 0x2e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x08, 0x80, 
-/* 0x0b20 */ 0x3f, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x45, 0xf6, 0x0a, 0x80, 0x00, 0x3e, 0x07, 0xae, 0x03, 
-/* 0x0b30 */ 0x08, 0x0b, 0x9c, 0x0c, 0x02, 0x00, 0xfc, 0x06, 0x40, 0x03, 0xae, 0x03, 0x78, 0x05, 0x3e, 0x07, 
-/* 0x0b40 */ 0x9c, 0x0c, 0x00, 0x00, 0xc2, 0x05, 0x4c, 0x0e, 0x52, 0x0b, 0xb8, 0x07, 0xee, 0x0b, 0x64, 0x0e, 
-/* 0x0b50 */ 0xbe, 0x0b, 0x3e, 0x07, 0x9c, 0x0c, 0x01, 0x00, 0xc2, 0x05, 0x4c, 0x0e, 0x68, 0x0b, 0xb8, 0x07, 
-/* 0x0b60 */ 0x58, 0x09, 0x10, 0x08, 0x64, 0x0e, 0xbe, 0x0b, 0x3e, 0x07, 0x9c, 0x0c, 0x02, 0x00, 0xc2, 0x05, 
-/* 0x0b70 */ 0x4c, 0x0e, 0x7c, 0x0b, 0xb8, 0x07, 0xee, 0x0b, 0x64, 0x0e, 0xbe, 0x0b, 0x3e, 0x07, 0x9c, 0x0c, 
-/* 0x0b80 */ 0x03, 0x00, 0xc2, 0x05, 0x4c, 0x0e, 0x92, 0x0b, 0x9c, 0x0c, 0xe6, 0x00, 0xb6, 0x02, 0x64, 0x0e, 
-/* 0x0b90 */ 0xb6, 0x0b, 0x3e, 0x07, 0x9c, 0x0c, 0x04, 0x00, 0xc2, 0x05, 0x4c, 0x0e, 0xa8, 0x0b, 0x9c, 0x0c, 
-/* 0x0ba0 */ 0xbc, 0x00, 0xb6, 0x02, 0x64, 0x0e, 0xb6, 0x0b, 0xb8, 0x07, 0xee, 0x0b, 0x64, 0x0e, 0xbe, 0x0b, 
-/* 0x0bb0 */ 0x9c, 0x0c, 0x10, 0x01, 0xb6, 0x02, 0x9c, 0x0c, 0x00, 0x00, 0x64, 0x0e, 0xc4, 0x0b, 0x80, 0x02, 
-/* 0x0bc0 */ 0x9c, 0x0c, 0x01, 0x00, 0x86, 0x00, 0x07, 0x80, 0x3f, 0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52, 0x00, 
-/* 0x0bd0 */ 0x1e, 0x0b, 0xd4, 0x0b, 0x80, 0x03, 0x46, 0x22, 0x88, 0x06, 0x80, 0x19, 0x08, 0x45, 0x00, 0x80, 
-/* 0x0be0 */ 0x8a, 0x00, 0x07, 0x80, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x45, 0x00, 0xc6, 0x0b, 0xf0, 0x0b, 
-/* 0x0bf0 */ 0xc0, 0x1b, 0x8c, 0x01, 0x88, 0x06, 0x90, 0x03, 0xff, 0x1f, 0x89, 0x29, 0xc8, 0x1d, 0xc5, 0x1e, 
-/* 0x0c00 */ 0xc0, 0x3e, 0x00, 0x80, 0x8e, 0x00, 0x05, 0x80, 0x54, 0x4f, 0x4b, 0x45, 0x4e, 0x00, 0xe2, 0x0b, 
-/* 0x0c10 */ 0x12, 0x0c, 0x90, 0x1b, 0x10, 0x02, 0x30, 0x02, 0x00, 0x03, 0x02, 0x22, 0x00, 0x06, 0x20, 0x03, 
-/* 0x0c20 */ 0x04, 0x22, 0x22, 0x06, 0x20, 0x3f, 0x28, 0xa5, 0x27, 0xa1, 0x20, 0x04, 0x98, 0x3f, 0x07, 0xb5, 
-/* 0x0c30 */ 0x20, 0x3f, 0x0f, 0xa5, 0x80, 0x07, 0x89, 0x3f, 0x02, 0xb5, 0x01, 0x1e, 0xf9, 0x81, 0x20, 0x3f, 
-/* 0x0c40 */ 0x08, 0xa5, 0x80, 0x07, 0x89, 0x3f, 0x05, 0xa5, 0x0a, 0x41, 0x03, 0xa5, 0x01, 0x1e, 0x11, 0x1e, 
-/* 0x0c50 */ 0xf6, 0x81, 0x10, 0x40, 0x11, 0xa5, 0x80, 0x03, 0x46, 0x22, 0x98, 0x06, 0x91, 0x10, 0x31, 0x01, 
-/* 0x0c60 */ 0x92, 0x1e, 0x01, 0x22, 0x80, 0x07, 0x98, 0x11, 0x01, 0x1e, 0x91, 0x1e, 0x1f, 0x1e, 0xfa, 0xb5, 
-/* 0x0c70 */ 0x80, 0x03, 0x02, 0x22, 0x01, 0x1e, 0x80, 0x10, 0x30, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 
-/* 0x0c80 */ 0x49, 0x4e, 0x4c, 0x49, 0x4e, 0x45, 0x06, 0x0c, 0x8a, 0x0c, 0x80, 0x03, 0x02, 0x22, 0x80, 0x19, 
-/* 0x0c90 */ 0x06, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x02, 0xc0, 0x2a, 0x23, 0x7e, 0x0c, 0x9e, 0x0c, 0x8a, 0x06, 
-/* 0x0ca0 */ 0x80, 0x19, 0xa2, 0x1e, 0x00, 0x80, 0x8a, 0x00, 0x05, 0xc0, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x00, 
-/* 0x0cb0 */ 0x96, 0x0c, 0xb4, 0x0c, 0x80, 0x03, 0x46, 0x22, 0x88, 0x06, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x0cc0 */ 0x05, 0xc0, 0x55, 0x4e, 0x54, 0x49, 0x4c, 0x00, 0xa8, 0x0c, 0xcc, 0x0c, 0x00, 0x1b, 0x10, 0x03, 
-/* 0x0cd0 */ 0xf0, 0x0c, 0x20, 0x03, 0x46, 0x22, 0x32, 0x06, 0x31, 0x10, 0x32, 0x1e, 0x30, 0x10, 0x32, 0x1e, 
-/* 0x0ce0 */ 0x23, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x06, 0xa0, 0x2a, 0x55, 0x4e, 0x54, 0x49, 0x4c, 0xc0, 0x0c, 
-/* 0x0cf0 */ 0xf2, 0x0c, 0x80, 0x1b, 0x80, 0x40, 0x03, 0xb5, 0xaa, 0x06, 0x00, 0x80, 0x8a, 0x00, 0xa2, 0x1e, 
-/* 0x0d00 */ 0x00, 0x80, 0x8a, 0x00, 0x04, 0xc0, 0x43, 0x41, 0x53, 0x45, 0xe6, 0x0c, 0x80, 0x00, 0x9c, 0x0c, 
-/* 0x0d10 */ 0x00, 0x00, 0x86, 0x00, 0x02, 0xc0, 0x4f, 0x46, 0x04, 0x0d, 0x1c, 0x0d, 0x30, 0x1b, 0x31, 0x1e, 
-/* 0x0d20 */ 0x00, 0x03, 0xa4, 0x0d, 0x10, 0x03, 0x46, 0x22, 0x21, 0x06, 0x20, 0x10, 0x22, 0x1e, 0x20, 0x19, 
-/* 0x0d30 */ 0x30, 0x19, 0x22, 0x1e, 0x12, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x05, 0xc0, 0x45, 0x4e, 0x44, 0x4f, 
-/* 0x0d40 */ 0x46, 0x00, 0x14, 0x0d, 0x46, 0x0d, 0x30, 0x1b, 0x20, 0x1b, 0x00, 0x03, 0x46, 0x22, 0x10, 0x06, 
-/* 0x0d50 */ 0x14, 0x1e, 0x21, 0x10, 0x80, 0x03, 0xca, 0x0d, 0x1c, 0x1e, 0x18, 0x10, 0x12, 0x1e, 0x10, 0x19, 
-/* 0x0d60 */ 0x30, 0x19, 0x12, 0x1e, 0x01, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x04, 0xc0, 0x45, 0x53, 0x41, 0x43, 
-/* 0x0d70 */ 0x3a, 0x0d, 0x74, 0x0d, 0x00, 0x1b, 0x10, 0x03, 0x46, 0x22, 0x11, 0x06, 0x20, 0x03, 0xdc, 0x0d, 
-/* 0x0d80 */ 0x12, 0x10, 0x12, 0x1e, 0x20, 0x03, 0x46, 0x22, 0x21, 0x10, 0x1e, 0x1e, 0x00, 0x29, 0x04, 0xa5, 
-/* 0x0d90 */ 0x0f, 0x1e, 0x20, 0x1b, 0x21, 0x10, 0xfa, 0x81, 0x00, 0x80, 0x8a, 0x00, 0x03, 0xa0, 0x2a, 0x4f, 
-/* 0x0da0 */ 0x46, 0x00, 0x6a, 0x0d, 0xa6, 0x0d, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x3f, 0x04, 0xa5, 0x90, 0x19, 
-/* 0x0db0 */ 0xaa, 0x06, 0x00, 0x80, 0x8a, 0x00, 0xa2, 0x1e, 0x00, 0x80, 0x8a, 0x00, 0x09, 0xa0, 0x2a, 0x4f, 
-/* 0x0dc0 */ 0x46, 0x5f, 0x45, 0x4e, 0x44, 0x4f, 0x46, 0x00, 0x9c, 0x0d, 0xcc, 0x0d, 0xaa, 0x06, 0x00, 0x80, 
-/* 0x0dd0 */ 0x8a, 0x00, 0x05, 0x80, 0x2a, 0x45, 0x53, 0x41, 0x43, 0x00, 0xbc, 0x0d, 0xde, 0x0d, 0x00, 0x80, 
-/* 0x0de0 */ 0x8a, 0x00, 0x02, 0xc0, 0x49, 0x46, 0xd2, 0x0d, 0xea, 0x0d, 0x00, 0x03, 0x4c, 0x0e, 0x10, 0x03, 
-/* 0x0df0 */ 0x46, 0x22, 0x21, 0x06, 0x20, 0x10, 0x22, 0x1e, 0x20, 0x19, 0x22, 0x1e, 0x12, 0x10, 0x00, 0x80, 
-/* 0x0e00 */ 0x8a, 0x00, 0x04, 0xc0, 0x45, 0x4c, 0x53, 0x45, 0xe2, 0x0d, 0x0c, 0x0e, 0x20, 0x1b, 0x00, 0x03, 
-/* 0x0e10 */ 0x46, 0x22, 0x10, 0x06, 0x14, 0x1e, 0x21, 0x10, 0x80, 0x03, 0x64, 0x0e, 0x1c, 0x1e, 0x18, 0x10, 
-/* 0x0e20 */ 0x12, 0x1e, 0x10, 0x19, 0x12, 0x1e, 0x01, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x04, 0xc0, 0x54, 0x48, 
-/* 0x0e30 */ 0x45, 0x4e, 0x02, 0x0e, 0x36, 0x0e, 0x80, 0x1b, 0x90, 0x03, 0x46, 0x22, 0x99, 0x06, 0x89, 0x10, 
-/* 0x0e40 */ 0x00, 0x80, 0x8a, 0x00, 0x03, 0xa0, 0x2a, 0x49, 0x46, 0x00, 0x2c, 0x0e, 0x4e, 0x0e, 0x80, 0x1b, 
-/* 0x0e50 */ 0x80, 0x40, 0x09, 0xa5, 0xa2, 0x1e, 0x00, 0x80, 0x8a, 0x00, 0x05, 0xa0, 0x2a, 0x45, 0x4c, 0x53, 
-/* 0x0e60 */ 0x45, 0x00, 0x44, 0x0e, 0x66, 0x0e, 0xaa, 0x06, 0x00, 0x80, 0x8a, 0x00, 0x02, 0xc0, 0x44, 0x4f, 
-/* 0x0e70 */ 0x5a, 0x0e, 0x80, 0x00, 0x9c, 0x0c, 0x86, 0x0e, 0x10, 0x08, 0xcc, 0x0a, 0x86, 0x00, 0x03, 0xa0, 
-/* 0x0e80 */ 0x2a, 0x44, 0x4f, 0x00, 0x6c, 0x0e, 0x88, 0x0e, 0x80, 0x1b, 0x90, 0x1b, 0x90, 0x1a, 0x80, 0x1a, 
-/* 0x0e90 */ 0x00, 0x80, 0x8a, 0x00, 0x04, 0xc0, 0x4c, 0x4f, 0x4f, 0x50, 0x7e, 0x0e, 0x80, 0x00, 0x9c, 0x0c, 
-/* 0x0ea0 */ 0xc8, 0x0e, 0x10, 0x08, 0x10, 0x08, 0x86, 0x00, 0x05, 0xc0, 0x2b, 0x4c, 0x4f, 0x4f, 0x50, 0x00, 
-/* 0x0eb0 */ 0x94, 0x0e, 0x80, 0x00, 0x9c, 0x0c, 0xee, 0x0e, 0x10, 0x08, 0x10, 0x08, 0x86, 0x00, 0x05, 0xa0, 
-/* 0x0ec0 */ 0x2a, 0x4c, 0x4f, 0x4f, 0x50, 0x00, 0xa8, 0x0e, 0xca, 0x0e, 0x80, 0x1c, 0x90, 0x1c, 0x81, 0x1e, 
-/* 0x0ed0 */ 0x89, 0x3f, 0x03, 0xa1, 0xa2, 0x1e, 0x00, 0x80, 0x8a, 0x00, 0x90, 0x1a, 0x80, 0x1a, 0xaa, 0x06, 
-/* 0x0ee0 */ 0x00, 0x80, 0x8a, 0x00, 0x06, 0xa0, 0x2a, 0x2b, 0x4c, 0x4f, 0x4f, 0x50, 0xbe, 0x0e, 0xf0, 0x0e, 
-/* 0x0ef0 */ 0x80, 0x1c, 0x90, 0x1c, 0x00, 0x1b, 0x80, 0x1d, 0xeb, 0x81, 0x03, 0x80, 0x3f, 0x53, 0x50, 0x00, 
-/* 0x0f00 */ 0xe4, 0x0e, 0x04, 0x0f, 0xd0, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x3f, 0x52, 0x53, 0x00, 
-/* 0x0f10 */ 0xfa, 0x0e, 0x14, 0x0f, 0xe0, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x50, 0x41, 0x54, 0x43, 
-/* 0x0f20 */ 0x48, 0x00, 0x0a, 0x0f, 0x80, 0x00, 0x40, 0x03, 0xae, 0x03, 0x4c, 0x0e, 0x42, 0x0f, 0x72, 0x0a, 
-/* 0x0f30 */ 0xae, 0x03, 0xae, 0x03, 0x3e, 0x07, 0xf6, 0x08, 0x34, 0x09, 0xae, 0x03, 0x72, 0x0a, 0xae, 0x03, 
-/* 0x0f40 */ 0xd8, 0x03, 0x74, 0x02, 0x86, 0x00, 0x05, 0x80, 0x4f, 0x55, 0x54, 0x45, 0x52, 0x00, 0x1a, 0x0f, 
-/* 0x0f50 */ 0x80, 0x00, 0x9c, 0x0c, 0x94, 0x00, 0xb6, 0x02, 0x9c, 0x10, 0x9c, 0x0c, 0x2e, 0x01, 0xb6, 0x02, 
-/* 0x0f60 */ 0x88, 0x0c, 0x3e, 0x07, 0xa2, 0x06, 0x4c, 0x0e, 0x70, 0x0f, 0xb8, 0x07, 0x64, 0x0e, 0x60, 0x0f, 
-/* 0x0f70 */ 0xde, 0x06, 0x4c, 0x0e, 0x7a, 0x0f, 0x64, 0x0e, 0x58, 0x0f, 0x94, 0x0f, 0x64, 0x0e, 0x58, 0x0f, 
-/* 0x0f80 */ 0x86, 0x00, 0x0e, 0x80, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53, 0x53, 0x2d, 0x54, 0x4f, 0x4b, 0x45, 
-/* 0x0f90 */ 0x4e, 0x53, 0x46, 0x0f, 0x80, 0x00, 0x44, 0x08, 0x10, 0x0c, 0x4c, 0x0e, 0xe0, 0x0f, 0xf0, 0x10, 
-/* 0x0fa0 */ 0x4c, 0x0e, 0xb6, 0x0f, 0x2a, 0x0b, 0x8e, 0x05, 0x4c, 0x0e, 0xb2, 0x0f, 0x24, 0x0f, 0x64, 0x0e, 
-/* 0x0fb0 */ 0xe0, 0x0f, 0x64, 0x0e, 0x96, 0x0f, 0xd2, 0x0b, 0x4c, 0x0e, 0xd0, 0x0f, 0x40, 0x03, 0xae, 0x03, 
-/* 0x0fc0 */ 0x4c, 0x0e, 0xcc, 0x0f, 0x9c, 0x0c, 0x9c, 0x0c, 0x10, 0x08, 0x10, 0x08, 0x64, 0x0e, 0x96, 0x0f, 
-/* 0x0fd0 */ 0x9c, 0x0c, 0xac, 0x00, 0xb6, 0x02, 0xe2, 0x08, 0xae, 0x03, 0xb6, 0x02, 0x64, 0x0e, 0x96, 0x0f, 
-/* 0x0fe0 */ 0x86, 0x00, 0x04, 0x80, 0x54, 0x52, 0x41, 0x50, 0x82, 0x0f, 0xec, 0x0f, 0x8f, 0x01, 0x04, 0x1f, 
-/* 0x0ff0 */ 0x07, 0x81, 0x0e, 0x00, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x21, 
-/* 0x1000 */ 0x80, 0x19, 0x01, 0x45, 0x00, 0x46, 0x00, 0x80, 0x8a, 0x00, 0x08, 0x80, 0x57, 0x4f, 0x52, 0x44, 
-/* 0x1010 */ 0x2d, 0x4c, 0x45, 0x4e, 0xe2, 0x0f, 0x18, 0x10, 0x80, 0x1b, 0x88, 0x06, 0x8f, 0x3e, 0x8e, 0x3e, 
-/* 0x1020 */ 0x8d, 0x3e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x2e, 0x57, 0x4f, 0x52, 0x44, 0x00, 
-/* 0x1030 */ 0x0a, 0x10, 0x34, 0x10, 0x00, 0x1b, 0x10, 0x06, 0x1f, 0x3e, 0x1e, 0x3e, 0x1d, 0x3e, 0x02, 0x1e, 
-/* 0x1040 */ 0x20, 0x07, 0x20, 0x19, 0x05, 0x45, 0x01, 0x1e, 0x1f, 0x1e, 0xfa, 0xb5, 0x00, 0x80, 0x8a, 0x00, 
-/* 0x1050 */ 0x06, 0x80, 0x2e, 0x53, 0x57, 0x4f, 0x52, 0x44, 0x28, 0x10, 0x80, 0x00, 0x32, 0x10, 0x60, 0x10, 
-/* 0x1060 */ 0x62, 0x10, 0x00, 0x1b, 0x01, 0x1e, 0x00, 0x3e, 0x02, 0x23, 0xd0, 0x1d, 0x00, 0x80, 0x88, 0x00, 
-/* 0x1070 */ 0x09, 0x80, 0x4e, 0x45, 0x58, 0x54, 0x2d, 0x57, 0x4f, 0x52, 0x44, 0x00, 0x50, 0x10, 0x80, 0x00, 
-/* 0x1080 */ 0x3e, 0x07, 0xae, 0x03, 0x9c, 0x0c, 0xff, 0x1f, 0x64, 0x05, 0xfc, 0x04, 0x1e, 0x09, 0x28, 0x07, 
-/* 0x1090 */ 0xae, 0x03, 0x86, 0x00, 0x04, 0x80, 0x43, 0x52, 0x45, 0x54, 0x70, 0x10, 0x9e, 0x10, 0x80, 0x03, 
-/* 0x10a0 */ 0x0a, 0x00, 0x80, 0x19, 0x05, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x57, 0x4f, 0x52, 0x44, 
-/* 0x10b0 */ 0x53, 0x00, 0x94, 0x10, 0x80, 0x00, 0x72, 0x0a, 0xae, 0x03, 0xae, 0x03, 0x3e, 0x07, 0x32, 0x10, 
-/* 0x10c0 */ 0x44, 0x08, 0xd8, 0x02, 0x7e, 0x10, 0x3e, 0x07, 0x8e, 0x05, 0x4c, 0x0e, 0xbc, 0x10, 0xb8, 0x07, 
-/* 0x10d0 */ 0x86, 0x00, 0x07, 0x80, 0x43, 0x4f, 0x4d, 0x50, 0x41, 0x52, 0x45, 0x00, 0xaa, 0x10, 0xe0, 0x10, 
-/* 0x10e0 */ 0x16, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0xd2, 0x10, 
-/* 0x10f0 */ 0xf2, 0x10, 0x80, 0x03, 0x46, 0x22, 0x08, 0x06, 0x10, 0x06, 0x02, 0x1e, 0x60, 0x01, 0x50, 0x03, 
-/* 0x1100 */ 0x4a, 0x22, 0x55, 0x06, 0x55, 0x06, 0x35, 0x06, 0x3f, 0x3e, 0x3e, 0x3e, 0x3d, 0x3e, 0x31, 0x3f, 
-/* 0x1110 */ 0x0a, 0xa5, 0x53, 0x1d, 0x53, 0x1e, 0x50, 0x3e, 0x55, 0x06, 0x55, 0x29, 0xf4, 0xb5, 0x80, 0x02, 
-/* 0x1120 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x26, 0x01, 0x45, 0x01, 0x42, 0x1e, 0x71, 0x01, 0x82, 0x07, 
-/* 0x1130 */ 0x94, 0x07, 0x89, 0x3f, 0xee, 0xb5, 0x21, 0x1e, 0x41, 0x1e, 0x7f, 0x1e, 0xf8, 0xb5, 0x50, 0x19, 
-/* 0x1140 */ 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x3a, 0x00, 0xe6, 0x10, 0x80, 0x00, 
-/* 0x1150 */ 0x72, 0x0a, 0xae, 0x03, 0x8a, 0x0a, 0xd8, 0x03, 0x1c, 0x0a, 0x9c, 0x0c, 0x80, 0x00, 0xba, 0x0a, 
-/* 0x1160 */ 0x9c, 0x0c, 0x01, 0x00, 0x40, 0x03, 0xd8, 0x03, 0x86, 0x00, 0x02, 0xc0, 0x2e, 0x22, 0x48, 0x11, 
-/* 0x1170 */ 0x80, 0x00, 0x9c, 0x0c, 0x44, 0x02, 0x10, 0x08, 0x9c, 0x0c, 0x22, 0x00, 0x10, 0x0c, 0x1e, 0x09, 
-/* 0x1180 */ 0x28, 0x07, 0xe2, 0x08, 0x10, 0x05, 0x86, 0x00, 0x02, 0xe0, 0x53, 0x22, 0x6a, 0x11, 0x80, 0x00, 
-/* 0x1190 */ 0x40, 0x03, 0xae, 0x03, 0x4c, 0x0e, 0xb0, 0x11, 0x9c, 0x0c, 0xf0, 0x11, 0x10, 0x08, 0x9c, 0x0c, 
-/* 0x11a0 */ 0x22, 0x00, 0x10, 0x0c, 0x1e, 0x09, 0x28, 0x07, 0xe2, 0x08, 0x10, 0x05, 0x64, 0x0e, 0xe6, 0x11, 
-/* 0x11b0 */ 0x9c, 0x0c, 0x22, 0x00, 0x10, 0x0c, 0xb8, 0x07, 0xba, 0x11, 0xbc, 0x11, 0x00, 0x03, 0x46, 0x22, 
-/* 0x11c0 */ 0x10, 0x06, 0x31, 0x06, 0x33, 0x1e, 0x30, 0x3e, 0x23, 0x01, 0xd3, 0x22, 0xd2, 0x1e, 0x41, 0x06, 
-/* 0x11d0 */ 0xd4, 0x10, 0x12, 0x1e, 0xd2, 0x1e, 0x2e, 0x1e, 0xfa, 0xb5, 0xd3, 0x22, 0x5d, 0x01, 0xde, 0x1e, 
-/* 0x11e0 */ 0x50, 0x19, 0x00, 0x80, 0x88, 0x00, 0x86, 0x00, 0x03, 0xa0, 0x2a, 0x53, 0x22, 0x00, 0x88, 0x11, 
-/* 0x11f0 */ 0xf2, 0x11, 0x8a, 0x01, 0x9a, 0x06, 0xa9, 0x1d, 0xa3, 0x1e, 0xa0, 0x3e, 0x80, 0x19, 0x00, 0x80, 
-/* 0x1200 */ 0x8a, 0x00, 0x01, 0x80, 0x3f, 0x00, 0xe8, 0x11, 0x80, 0x00, 0x44, 0x02, 0x01, 0x00, 0x3f, 0x00, 
-/* 0x1210 */ 0x74, 0x02, 0x86, 0x00, 0x01, 0x80, 0x27, 0x00, 0x02, 0x12, 0x80, 0x00, 0x44, 0x08, 0x10, 0x0c, 
-/* 0x1220 */ 0xb8, 0x07, 0xf0, 0x10, 0x8e, 0x05, 0x4c, 0x0e, 0x2c, 0x12, 0x08, 0x12, 0x58, 0x09, 0x86, 0x00, 
-/* 0x1230 */ 0x02, 0x80, 0x4e, 0x27, 0x14, 0x12, 0x80, 0x00, 0x44, 0x08, 0x10, 0x0c, 0xb8, 0x07, 0xf0, 0x10, 
-/* 0x1240 */ 0x8e, 0x05, 0x4c, 0x0e, 0x48, 0x12, 0x02, 0x12, 0x86, 0x00, 0x06, 0x80, 0x46, 0x4f, 0x52, 0x47, 
-/* 0x1250 */ 0x45, 0x54, 0x30, 0x12, 0x80, 0x00, 0x72, 0x0a, 0xae, 0x03, 0x8a, 0x0a, 0xd8, 0x03, 0x36, 0x12, 
-/* 0x1260 */ 0x3e, 0x07, 0x7e, 0x10, 0x72, 0x0a, 0xae, 0x03, 0xd8, 0x03, 0xe2, 0x08, 0xd8, 0x03, 0x86, 0x00, 
-/* 0x1270 */ 0x05, 0x80, 0x53, 0x54, 0x41, 0x54, 0x45, 0x00, 0x4a, 0x12, 0x7c, 0x12, 0x80, 0x03, 0x50, 0x22, 
-/* 0x1280 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0xe0, 0x5c, 0x00, 0x70, 0x12, 0x80, 0x00, 0x9c, 0x0c, 
-/* 0x1290 */ 0x5c, 0x00, 0x10, 0x0c, 0xb8, 0x07, 0x86, 0x00, 0x01, 0xe0, 0x28, 0x00, 0x86, 0x12, 0x80, 0x00, 
-/* 0x12a0 */ 0x9c, 0x0c, 0x29, 0x00, 0x10, 0x0c, 0xb8, 0x07, 0x86, 0x00, 0x06, 0x80, 0x43, 0x53, 0x50, 0x4c, 
-/* 0x12b0 */ 0x49, 0x54, 0x98, 0x12, 0xb6, 0x12, 0x80, 0x1b, 0x98, 0x01, 0x00, 0x03, 0xff, 0x00, 0x80, 0x29, 
-/* 0x12c0 */ 0x98, 0x37, 0x80, 0x19, 0x90, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 0x2e, 0x32, 0x42, 0x59, 
-/* 0x12d0 */ 0x54, 0x45, 0x53, 0x00, 0xaa, 0x12, 0x80, 0x00, 0xb4, 0x12, 0xa2, 0x07, 0x28, 0x03, 0x44, 0x08, 
-/* 0x12e0 */ 0xd8, 0x02, 0x28, 0x03, 0x86, 0x00, 0x04, 0x80, 0x44, 0x55, 0x4d, 0x50, 0xaa, 0x12, 0x80, 0x00, 
-/* 0x12f0 */ 0xc8, 0x07, 0xfc, 0x04, 0xa2, 0x07, 0x86, 0x0e, 0xde, 0x07, 0xae, 0x03, 0xde, 0x07, 0x12, 0x03, 
-/* 0x1300 */ 0x44, 0x08, 0xd8, 0x02, 0x3e, 0x07, 0xb4, 0x12, 0xa2, 0x07, 0x28, 0x03, 0x44, 0x08, 0xd8, 0x02, 
-/* 0x1310 */ 0x28, 0x03, 0xb4, 0x12, 0xa2, 0x07, 0x44, 0x08, 0xd8, 0x02, 0xd8, 0x02, 0x44, 0x08, 0xd8, 0x02, 
-/* 0x1320 */ 0xd8, 0x02, 0x9c, 0x10, 0x9c, 0x0c, 0x02, 0x00, 0xee, 0x0e, 0xf8, 0x12, 0x86, 0x00, 0x0b, 0x80, 
-/* 0x1330 */ 0x46, 0x52, 0x45, 0x45, 0x2d, 0x4d, 0x45, 0x4d, 0x4f, 0x52, 0x59, 0x00, 0xe6, 0x12, 0x40, 0x13, 
-/* 0x1340 */ 0x17, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x08, 0x80, 0x2a, 0x41, 0x52, 0x44, 0x55, 0x49, 0x4e, 0x4f, 
-/* 0x1350 */ 0x2e, 0x13, 0x54, 0x13, 0x18, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x46, 0x4f, 0x50, 0x45, 
-/* 0x1360 */ 0x4e, 0x00, 0x46, 0x13, 0x66, 0x13, 0x20, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x46, 0x43, 
-/* 0x1370 */ 0x4c, 0x4f, 0x53, 0x45, 0x5a, 0x13, 0x78, 0x13, 0x21, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 
-/* 0x1380 */ 0x46, 0x52, 0x45, 0x41, 0x44, 0x00, 0x6c, 0x13, 0x8a, 0x13, 0x80, 0x03, 0x02, 0x22, 0x80, 0x19, 
-/* 0x1390 */ 0x22, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x46, 0x45, 0x4f, 0x46, 0x7e, 0x13, 0x80, 0x00, 
-/* 0x13a0 */ 0x9c, 0x0c, 0xff, 0xff, 0x86, 0x00, 0x09, 0x80, 0x52, 0x45, 0x41, 0x44, 0x5f, 0x46, 0x49, 0x4c, 
-/* 0x13b0 */ 0x45, 0x00, 0x96, 0x13, 0x80, 0x00, 0x9c, 0x0c, 0x00, 0x00, 0x64, 0x13, 0x4c, 0x0e, 0xd0, 0x13, 
-/* 0x13c0 */ 0x88, 0x13, 0x9e, 0x13, 0xe2, 0x05, 0x4c, 0x0e, 0xe8, 0x13, 0x94, 0x0f, 0x64, 0x0e, 0xc0, 0x13, 
-/* 0x13d0 */ 0x44, 0x02, 0x10, 0x00, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20, 
-/* 0x13e0 */ 0x66, 0x69, 0x6c, 0x65, 0x64, 0x0e, 0xee, 0x13, 0x9c, 0x0c, 0x00, 0x00, 0x76, 0x13, 0x86, 0x00, 
-/* 0x13f0 */ 0x09, 0x80, 0x57, 0x52, 0x49, 0x54, 0x45, 0x2d, 0x43, 0x50, 0x50, 0x00, 0xa6, 0x13, 0x00, 0x14, 
-/* 0x1400 */ 0x00, 0x03, 0x4a, 0x22, 0x10, 0x06, 0x11, 0x06, 0x20, 0x03, 0x0a, 0x00, 0x22, 0x1e, 0x21, 0x10, 
-/* 0x1410 */ 0x15, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x0e, 0x80, 0x23, 0x50, 0x49, 0x4e, 0x4d, 0x4f, 0x44, 0x45, 
-/* 0x1420 */ 0x2d, 0x49, 0x4e, 0x50, 0x55, 0x54, 0xf0, 0x13, 0xee, 0x0a, 0x00, 0x00, 0x0f, 0x80, 0x23, 0x50, 
-/* 0x1430 */ 0x49, 0x4e, 0x4d, 0x4f, 0x44, 0x45, 0x2d, 0x4f, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x16, 0x14, 
-/* 0x1440 */ 0xee, 0x0a, 0x01, 0x00, 0x15, 0x80, 0x23, 0x50, 0x49, 0x4e, 0x4d, 0x4f, 0x44, 0x45, 0x2d, 0x49, 
-/* 0x1450 */ 0x4e, 0x50, 0x55, 0x54, 0x2d, 0x50, 0x55, 0x4c, 0x4c, 0x55, 0x50, 0x00, 0x2c, 0x14, 0xee, 0x0a, 
-/* 0x1460 */ 0x02, 0x00, 0x17, 0x80, 0x23, 0x50, 0x49, 0x4e, 0x4d, 0x4f, 0x44, 0x45, 0x2d, 0x49, 0x4e, 0x50, 
-/* 0x1470 */ 0x55, 0x54, 0x2d, 0x50, 0x55, 0x4c, 0x4c, 0x44, 0x4f, 0x57, 0x4e, 0x00, 0x44, 0x14, 0xee, 0x0a, 
-/* 0x1480 */ 0x03, 0x00, 0x0f, 0x80, 0x23, 0x50, 0x49, 0x4e, 0x4d, 0x4f, 0x44, 0x45, 0x2d, 0x41, 0x4e, 0x41, 
-/* 0x1490 */ 0x4c, 0x4f, 0x47, 0x00, 0x62, 0x14, 0xee, 0x0a, 0x04, 0x00, 0x1a, 0x80, 0x23, 0x50, 0x49, 0x4e, 
-/* 0x14a0 */ 0x4d, 0x4f, 0x44, 0x45, 0x2d, 0x4f, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2d, 0x4f, 0x50, 0x45, 0x4e, 
-/* 0x14b0 */ 0x2d, 0x44, 0x52, 0x41, 0x49, 0x4e, 0x82, 0x14, 0xee, 0x0a, 0x05, 0x00, 0x08, 0x80, 0x23, 0x50, 
-/* 0x14c0 */ 0x49, 0x4e, 0x4d, 0x4f, 0x44, 0x45, 0x9a, 0x14, 0xee, 0x0a, 0x00, 0x00, 0x0e, 0x80, 0x23, 0x44, 
-/* 0x14d0 */ 0x49, 0x47, 0x49, 0x54, 0x41, 0x4c, 0x2d, 0x57, 0x52, 0x49, 0x54, 0x45, 0xbc, 0x14, 0xee, 0x0a, 
-/* 0x14e0 */ 0x01, 0x00, 0x0d, 0x80, 0x23, 0x44, 0x49, 0x47, 0x49, 0x54, 0x41, 0x4c, 0x2d, 0x52, 0x45, 0x41, 
-/* 0x14f0 */ 0x44, 0x00, 0xcc, 0x14, 0xee, 0x0a, 0x02, 0x00, 0x0c, 0x80, 0x23, 0x41, 0x4e, 0x41, 0x4c, 0x4f, 
-/* 0x1500 */ 0x47, 0x2d, 0x52, 0x45, 0x41, 0x44, 0xe2, 0x14, 0xee, 0x0a, 0x03, 0x00, 0x06, 0x80, 0x23, 0x44, 
-/* 0x1510 */ 0x45, 0x4c, 0x41, 0x59, 0xf8, 0x14, 0xee, 0x0a, 0x04, 0x00, 0x07, 0x80, 0x23, 0x4d, 0x49, 0x4c, 
-/* 0x1520 */ 0x4c, 0x49, 0x53, 0x54, 0x0c, 0x15, 0xee, 0x0a, 0x05, 0x00, 0x08, 0x80, 0x50, 0x49, 0x4e, 0x4d, 
-/* 0x1530 */ 0x4f, 0x44, 0x45, 0x21, 0x1a, 0x15, 0x80, 0x00, 0xc8, 0x14, 0x52, 0x13, 0x86, 0x00, 0x04, 0x80, 
-/* 0x1540 */ 0x50, 0x49, 0x4e, 0x21, 0x2a, 0x15, 0x80, 0x00, 0xde, 0x14, 0x52, 0x13, 0x86, 0x00, 0x04, 0x80, 
-/* 0x1550 */ 0x50, 0x49, 0x4e, 0x40, 0x3e, 0x15, 0x80, 0x00, 0xf4, 0x14, 0x52, 0x13, 0x86, 0x00, 0x07, 0x80, 
-/* 0x1560 */ 0x41, 0x4e, 0x41, 0x4c, 0x4f, 0x47, 0x40, 0x00, 0x4e, 0x15, 0x80, 0x00, 0x08, 0x15, 0x52, 0x13, 
-/* 0x1570 */ 0x86, 0x00, 0x05, 0x80, 0x44, 0x45, 0x4c, 0x41, 0x59, 0x44, 0x5e, 0x15, 0x80, 0x00, 0x16, 0x15, 
-/* 0x1580 */ 0x52, 0x13, 0x86, 0x00, 0x09, 0x00, 0x57, 0x52, 0x49, 0x54, 0x45, 0x2d, 0x43, 0x50, 0x50, 0x00, 
-/* 0x1590 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x15a0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x15b0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x15c0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x15d0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x15e0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x15f0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1600 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1610 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1620 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1630 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1640 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1650 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1660 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1670 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1680 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1690 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x16a0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x16b0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x16c0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x16d0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x16e0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x16f0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1700 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1710 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1720 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1730 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1740 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1750 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1760 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1770 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1780 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1790 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x17a0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x17b0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x17c0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x17d0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x17e0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x17f0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1800 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1810 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1820 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1830 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1840 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1850 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1860 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1870 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1880 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1890 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x18a0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x18b0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x18c0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x18d0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x18e0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+/* 0x0090 */ 0xc2, 0x1e, 0xfb, 0x01, 0xa0, 0x1a, 0xc0, 0xc2, 0xa0, 0x1c, 0xf7, 0x81, 0xa0, 0x1c, 0xf5, 0x81, 
+/* 0x00a0 */ 0xa2, 0x00, 0xfa, 0x01, 0xa0, 0x1a, 0xc0, 0x1a, 0x90, 0x1c, 0x89, 0x07, 0x91, 0x1e, 0x85, 0x40, 
+/* 0x00b0 */ 0x0b, 0xa1, 0x8b, 0x1e, 0x88, 0x1d, 0xc0, 0x03, 0x6e, 0x0a, 0xc8, 0x1d, 0xcc, 0x06, 0x90, 0x1a, 
+/* 0x00c0 */ 0xa0, 0x03, 0xf8, 0x00, 0x00, 0x80, 0x8e, 0x00, 0x80, 0x40, 0x13, 0xa5, 0xc9, 0x07, 0x91, 0x1e, 
+/* 0x00d0 */ 0xb9, 0x07, 0x91, 0x1e, 0xb8, 0x36, 0xcb, 0x2a, 0x81, 0x40, 0xf1, 0xa5, 0x82, 0x40, 0x07, 0xa5, 
+/* 0x00e0 */ 0x83, 0x40, 0x03, 0xa5, 0x80, 0x1b, 0x80, 0x40, 0xe0, 0xb5, 0x9c, 0x01, 0xde, 0x81, 0xc0, 0x19, 
+/* 0x00f0 */ 0xdc, 0x81, 0xa0, 0x1c, 0x00, 0x80, 0x8a, 0x00, 0xfa, 0x00, 0xa8, 0x00, 0x16, 0x00, 0x48, 0x65, 
+/* 0x0100 */ 0x6c, 0x6c, 0x6f, 0x21, 0x20, 0x49, 0x27, 0x6d, 0x20, 0x61, 0x20, 0x54, 0x49, 0x4c, 0x20, 0x3a, 
+/* 0x0110 */ 0x2d, 0x29, 0x20, 0x3e, 0x0e, 0x00, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x74, 0x6f, 
+/* 0x0120 */ 0x6b, 0x65, 0x6e, 0x20, 0x27, 0x00, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2d, 0x74, 0x69, 
+/* 0x0130 */ 0x6d, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x62, 0x69, 0x64, 0x64, 
+/* 0x0140 */ 0x65, 0x6e, 0x20, 0x61, 0x74, 0x20, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x00, 0x27, 0x00, 
+/* 0x0150 */ 0x52, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x66, 0x6f, 
+/* 0x0160 */ 0x72, 0x62, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 
+/* 0x0170 */ 0x6c, 0x65, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x00, 0x0c, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 
+/* 0x0180 */ 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0e, 0x00, 0x57, 0x6f, 0x72, 0x64, 0x20, 0x6e, 0x6f, 0x74, 
+/* 0x0190 */ 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x06, 0x00, 0x20, 0x4f, 0x4b, 0x20, 0x3e, 0x3e, 0x0f, 0x00, 
+/* 0x01a0 */ 0x53, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x00, 
+/* 0x01b0 */ 0x16, 0x00, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x75, 
+/* 0x01c0 */ 0x6e, 0x64, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x0e, 0x00, 0x53, 0x74, 0x61, 0x63, 0x6b, 0x20, 
+/* 0x01d0 */ 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x15, 0x00, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+/* 0x01e0 */ 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x00, 
+/* 0x01f0 */ 0x1e, 0x00, 0x57, 0x6f, 0x72, 0x64, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x63, 
+/* 0x0200 */ 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x65, 0x64, 
+/* 0x0210 */ 0x81, 0x02, 0x90, 0x03, 0x52, 0x30, 0x98, 0x10, 0x80, 0x03, 0x04, 0x00, 0x90, 0x03, 0x5e, 0x30, 
+/* 0x0220 */ 0x98, 0x10, 0x80, 0x02, 0x90, 0x03, 0x60, 0x30, 0x98, 0x10, 0x90, 0x03, 0x8a, 0x30, 0x98, 0x10, 
+/* 0x0230 */ 0x00, 0x80, 0x24, 0x00, 0x6e, 0x12, 0x76, 0x11, 0x34, 0x02, 0x07, 0x80, 0x3c, 0x42, 0x55, 0x49, 
+/* 0x0240 */ 0x4c, 0x44, 0x53, 0x00, 0x00, 0x00, 0x80, 0x00, 0xae, 0x0f, 0x00, 0x00, 0xb0, 0x0d, 0x86, 0x00, 
+/* 0x0250 */ 0x05, 0x80, 0x44, 0x4f, 0x45, 0x53, 0x3e, 0x00, 0x3a, 0x02, 0x80, 0x00, 0x66, 0x0b, 0x8a, 0x0b, 
+/* 0x0260 */ 0x3c, 0x0c, 0xf8, 0x04, 0x58, 0x0b, 0xa0, 0x1a, 0xac, 0x06, 0xc2, 0x1e, 0xc0, 0x19, 0x00, 0x80, 
+/* 0x0270 */ 0x8a, 0x00, 0x09, 0x80, 0x49, 0x4d, 0x4d, 0x45, 0x44, 0x49, 0x41, 0x54, 0x45, 0x00, 0x50, 0x02, 
+/* 0x0280 */ 0x82, 0x02, 0x80, 0x03, 0x4a, 0x30, 0x98, 0x06, 0x99, 0x06, 0x89, 0x06, 0x00, 0x03, 0x00, 0xc0, 
+/* 0x0290 */ 0x80, 0x2a, 0x98, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 0x52, 0x55, 0x4e, 0x54, 0x49, 0x4d, 
+/* 0x02a0 */ 0x45, 0x00, 0x72, 0x02, 0xa6, 0x02, 0x80, 0x03, 0x4a, 0x30, 0x98, 0x06, 0x99, 0x06, 0x89, 0x06, 
+/* 0x02b0 */ 0x00, 0x03, 0x00, 0xa0, 0x80, 0x2a, 0x98, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x09, 0x80, 0x45, 0x58, 
+/* 0x02c0 */ 0x45, 0x43, 0x55, 0x54, 0x49, 0x56, 0x45, 0x00, 0x98, 0x02, 0xcc, 0x02, 0x80, 0x03, 0x4a, 0x30, 
+/* 0x02d0 */ 0x98, 0x06, 0x99, 0x06, 0x89, 0x06, 0x00, 0x03, 0x00, 0xe0, 0x80, 0x2a, 0x98, 0x10, 0x00, 0x80, 
+/* 0x02e0 */ 0x8a, 0x00, 0x0a, 0x80, 0x56, 0x4f, 0x43, 0x41, 0x42, 0x55, 0x4c, 0x41, 0x52, 0x59, 0xbc, 0x02, 
+/* 0x02f0 */ 0x80, 0x00, 0x46, 0x02, 0x8a, 0x0b, 0x44, 0x09, 0x5a, 0x02, 0x54, 0x0d, 0xf8, 0x04, 0x86, 0x00, 
+/* 0x0300 */ 0x04, 0x80, 0x43, 0x4f, 0x44, 0x45, 0xe2, 0x02, 0x0a, 0x03, 0x80, 0x03, 0x4c, 0x30, 0x90, 0x03, 
+/* 0x0310 */ 0x48, 0x30, 0x98, 0x06, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x2a, 0x22, 0x00, 0x03, 0x20, 0x03, 
+/* 0x0320 */ 0x8a, 0x06, 0xa0, 0x19, 0x01, 0x45, 0xa8, 0x1d, 0xa3, 0x1e, 0xa0, 0x3e, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0330 */ 0x05, 0x80, 0x44, 0x45, 0x42, 0x55, 0x47, 0x03, 0x18, 0x03, 0x3c, 0x03, 0x00, 0x45, 0x00, 0x80, 
+/* 0x0340 */ 0x8a, 0x00, 0x07, 0x80, 0x52, 0x45, 0x53, 0x54, 0x41, 0x52, 0x54, 0x00, 0x30, 0x03, 0x24, 0x00, 
+/* 0x0350 */ 0x06, 0x80, 0x2a, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x42, 0x03, 0x5c, 0x03, 0x00, 0x03, 0x00, 0x38, 
+/* 0x0360 */ 0x0d, 0x22, 0x06, 0xb1, 0xd0, 0x03, 0x00, 0x38, 0x80, 0x03, 0x9e, 0x01, 0x80, 0x19, 0x02, 0x45, 
+/* 0x0370 */ 0x00, 0x03, 0xfe, 0x3f, 0x0e, 0x22, 0x06, 0xb1, 0x80, 0x03, 0xb0, 0x01, 0x80, 0x19, 0x02, 0x45, 
+/* 0x0380 */ 0x00, 0x80, 0x24, 0x00, 0x00, 0x80, 0x8a, 0x00, 0xae, 0x0f, 0x07, 0x00, 0x1c, 0x06, 0xd2, 0x03, 
+/* 0x0390 */ 0xbe, 0x13, 0x42, 0x12, 0x04, 0x80, 0x54, 0x59, 0x50, 0x45, 0x50, 0x03, 0x9e, 0x03, 0x01, 0x45, 
+/* 0x03a0 */ 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x54, 0x59, 0x50, 0x45, 0x4c, 0x4e, 0x94, 0x03, 0xb0, 0x03, 
+/* 0x03b0 */ 0x02, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x45, 0x4d, 0x49, 0x54, 0xa4, 0x03, 0xc0, 0x03, 
+/* 0x03c0 */ 0x05, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 0x4d, 0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x00, 
+/* 0x03d0 */ 0xb6, 0x03, 0xd4, 0x03, 0x80, 0x1b, 0x90, 0x03, 0xfc, 0x00, 0x88, 0x29, 0x06, 0xa5, 0x09, 0x06, 
+/* 0x03e0 */ 0x90, 0x1d, 0x93, 0x1e, 0x90, 0x3e, 0x8f, 0x1e, 0xf8, 0x81, 0x90, 0x19, 0x01, 0x45, 0x00, 0x80, 
+/* 0x03f0 */ 0x8a, 0x00, 0x01, 0x80, 0x2e, 0x00, 0xc6, 0x03, 0xfa, 0x03, 0x84, 0x02, 0x90, 0x03, 0x00, 0x30, 
+/* 0x0400 */ 0x99, 0x06, 0x90, 0x19, 0x80, 0x19, 0x80, 0x03, 0x66, 0x30, 0x80, 0x19, 0x1f, 0x45, 0x01, 0x45, 
+/* 0x0410 */ 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x2e, 0x43, 0xf2, 0x03, 0x1c, 0x04, 0x80, 0x03, 0x00, 0x30, 
+/* 0x0420 */ 0x98, 0x06, 0x90, 0x19, 0x14, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x55, 0x2e, 0x14, 0x04, 
+/* 0x0430 */ 0x32, 0x04, 0x81, 0x02, 0x00, 0x80, 0xfc, 0x03, 0x02, 0x80, 0x44, 0x2e, 0x2a, 0x04, 0x40, 0x04, 
+/* 0x0440 */ 0x82, 0x02, 0x00, 0x80, 0xfc, 0x03, 0x03, 0x80, 0x55, 0x44, 0x2e, 0x00, 0x38, 0x04, 0x50, 0x04, 
+/* 0x0450 */ 0x82, 0x02, 0x81, 0x1e, 0x00, 0x80, 0xfc, 0x03, 0x04, 0x80, 0x4d, 0x4f, 0x44, 0x45, 0x46, 0x04, 
+/* 0x0460 */ 0x62, 0x04, 0x80, 0x03, 0x4e, 0x30, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x42, 0x41, 
+/* 0x0470 */ 0x53, 0x45, 0x58, 0x04, 0x76, 0x04, 0x80, 0x03, 0x00, 0x30, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0480 */ 0x03, 0x80, 0x48, 0x45, 0x58, 0x00, 0x6c, 0x04, 0x8a, 0x04, 0x80, 0x03, 0x00, 0x30, 0x10, 0x05, 
+/* 0x0490 */ 0x89, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 0x44, 0x45, 0x43, 0x49, 0x4d, 0x41, 0x4c, 0x00, 
+/* 0x04a0 */ 0x80, 0x04, 0xa4, 0x04, 0x80, 0x03, 0x00, 0x30, 0x0a, 0x05, 0x89, 0x10, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x04b0 */ 0x06, 0x80, 0x42, 0x49, 0x4e, 0x41, 0x52, 0x59, 0x96, 0x04, 0xbc, 0x04, 0x80, 0x03, 0x00, 0x30, 
+/* 0x04c0 */ 0x02, 0x05, 0x89, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x40, 0x00, 0xb0, 0x04, 0xd0, 0x04, 
+/* 0x04d0 */ 0x80, 0x1b, 0x88, 0x06, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x43, 0x40, 0xc8, 0x04, 
+/* 0x04e0 */ 0xe2, 0x04, 0x80, 0x1b, 0x98, 0x06, 0x80, 0x03, 0xff, 0x00, 0x98, 0x29, 0x90, 0x19, 0x00, 0x80, 
+/* 0x04f0 */ 0x8a, 0x00, 0x01, 0x80, 0x21, 0x00, 0xda, 0x04, 0xfa, 0x04, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x10, 
+/* 0x0500 */ 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x48, 0x40, 0xf2, 0x04, 0x0c, 0x05, 0x09, 0x45, 0x00, 0x80, 
+/* 0x0510 */ 0x8a, 0x00, 0x02, 0x80, 0x48, 0x21, 0x04, 0x05, 0x1a, 0x05, 0x0a, 0x45, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0520 */ 0x02, 0x80, 0x44, 0x40, 0x12, 0x05, 0x28, 0x05, 0x00, 0x1b, 0x10, 0x06, 0x02, 0x1e, 0x20, 0x06, 
+/* 0x0530 */ 0x10, 0x19, 0x20, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x44, 0x21, 0x20, 0x05, 0x40, 0x05, 
+/* 0x0540 */ 0x00, 0x1b, 0x10, 0x1b, 0x20, 0x1b, 0x02, 0x10, 0x02, 0x1e, 0x01, 0x10, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0550 */ 0x02, 0x80, 0x44, 0x2b, 0x38, 0x05, 0x58, 0x05, 0x0b, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 
+/* 0x0560 */ 0x44, 0x41, 0x4e, 0x44, 0x50, 0x05, 0x68, 0x05, 0x11, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 
+/* 0x0570 */ 0x44, 0x4f, 0x52, 0x00, 0x5e, 0x05, 0x78, 0x05, 0x12, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 
+/* 0x0580 */ 0x44, 0x49, 0x4e, 0x56, 0x45, 0x52, 0x54, 0x00, 0x6e, 0x05, 0x8c, 0x05, 0x13, 0x45, 0x00, 0x80, 
+/* 0x0590 */ 0x8a, 0x00, 0x02, 0x80, 0x44, 0x2d, 0x7e, 0x05, 0x9a, 0x05, 0x0c, 0x45, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x05a0 */ 0x02, 0x80, 0x44, 0x2a, 0x92, 0x05, 0xa8, 0x05, 0x0d, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 
+/* 0x05b0 */ 0x44, 0x2f, 0xa0, 0x05, 0xb6, 0x05, 0x0e, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x44, 0x3e, 
+/* 0x05c0 */ 0x3e, 0x00, 0xae, 0x05, 0xc6, 0x05, 0x0f, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x44, 0x3c, 
+/* 0x05d0 */ 0x3c, 0x00, 0xbc, 0x05, 0xd6, 0x05, 0x10, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x44, 0x53, 
+/* 0x05e0 */ 0x57, 0x41, 0x50, 0x00, 0xcc, 0x05, 0xe8, 0x05, 0x00, 0x1b, 0x10, 0x1b, 0x20, 0x1b, 0x30, 0x1b, 
+/* 0x05f0 */ 0x10, 0x19, 0x00, 0x19, 0x30, 0x19, 0x20, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x44, 0x44, 
+/* 0x0600 */ 0x55, 0x50, 0xdc, 0x05, 0x06, 0x06, 0x00, 0x1b, 0x10, 0x1b, 0x10, 0x19, 0x00, 0x19, 0x10, 0x19, 
+/* 0x0610 */ 0x00, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x2b, 0x00, 0xfc, 0x05, 0x1e, 0x06, 0x80, 0x1b, 
+/* 0x0620 */ 0x90, 0x1b, 0x89, 0x1d, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x2b, 0x21, 0x16, 0x06, 
+/* 0x0630 */ 0x32, 0x06, 0x80, 0x1b, 0x90, 0x1b, 0x08, 0x06, 0x09, 0x1d, 0x80, 0x10, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0640 */ 0x01, 0x80, 0x2d, 0x00, 0x2a, 0x06, 0x48, 0x06, 0x80, 0x1b, 0x90, 0x1b, 0x98, 0x22, 0x90, 0x19, 
+/* 0x0650 */ 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x2a, 0x00, 0x40, 0x06, 0x5c, 0x06, 0x80, 0x1b, 0x90, 0x1b, 
+/* 0x0660 */ 0x98, 0x27, 0x90, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x2f, 0x00, 0x54, 0x06, 0x70, 0x06, 
+/* 0x0670 */ 0x80, 0x1b, 0x90, 0x1b, 0x98, 0x28, 0x90, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x41, 0x4e, 
+/* 0x0680 */ 0x44, 0x00, 0x68, 0x06, 0x86, 0x06, 0x80, 0x1b, 0x90, 0x1b, 0x98, 0x29, 0x90, 0x19, 0x00, 0x80, 
+/* 0x0690 */ 0x8a, 0x00, 0x02, 0x80, 0x4f, 0x52, 0x7c, 0x06, 0x9a, 0x06, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x2a, 
+/* 0x06a0 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x4e, 0x4f, 0x54, 0x00, 0x92, 0x06, 0xb0, 0x06, 
+/* 0x06b0 */ 0x80, 0x1b, 0x80, 0x40, 0x04, 0xa5, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x81, 0x02, 
+/* 0x06c0 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x49, 0x4e, 0x56, 0x45, 0x52, 0x54, 0xa6, 0x06, 
+/* 0x06d0 */ 0xd2, 0x06, 0x80, 0x1b, 0x80, 0x2b, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x3d, 0x00, 
+/* 0x06e0 */ 0xc6, 0x06, 0xe4, 0x06, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x3f, 0x04, 0xb5, 0x81, 0x02, 0x80, 0x19, 
+/* 0x06f0 */ 0x00, 0x80, 0x8a, 0x00, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x21, 0x3d, 
+/* 0x0700 */ 0xdc, 0x06, 0x04, 0x07, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x3f, 0x04, 0xb5, 0x80, 0x02, 0x80, 0x19, 
+/* 0x0710 */ 0x00, 0x80, 0x8a, 0x00, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x3e, 0x00, 
+/* 0x0720 */ 0xfc, 0x06, 0x24, 0x07, 0x80, 0x1b, 0x90, 0x1b, 0x0d, 0x81, 0x02, 0x80, 0x3e, 0x3d, 0x1c, 0x07, 
+/* 0x0730 */ 0x32, 0x07, 0x80, 0x1b, 0x90, 0x1b, 0x1f, 0x81, 0x01, 0x80, 0x3c, 0x00, 0x2a, 0x07, 0x40, 0x07, 
+/* 0x0740 */ 0x90, 0x1b, 0x80, 0x1b, 0x89, 0x3f, 0x09, 0xa5, 0x08, 0x01, 0x09, 0x2c, 0x0f, 0x3c, 0x03, 0xa5, 
+/* 0x0750 */ 0x8f, 0x3c, 0x03, 0xa5, 0x06, 0x81, 0x89, 0x3f, 0x04, 0xa1, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 
+/* 0x0760 */ 0x8a, 0x00, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x3c, 0x3d, 0x38, 0x07, 
+/* 0x0770 */ 0x72, 0x07, 0x90, 0x1b, 0x80, 0x1b, 0x89, 0x3f, 0xf4, 0xa5, 0xe6, 0x81, 0x02, 0x80, 0x55, 0x3c, 
+/* 0x0780 */ 0x6a, 0x07, 0x84, 0x07, 0x90, 0x1b, 0x80, 0x1b, 0x89, 0x3f, 0x04, 0xa1, 0x80, 0x02, 0x80, 0x19, 
+/* 0x0790 */ 0x00, 0x80, 0x8a, 0x00, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x55, 0x3e, 
+/* 0x07a0 */ 0x7c, 0x07, 0xa4, 0x07, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x3f, 0x04, 0xa1, 0x80, 0x02, 0x80, 0x19, 
+/* 0x07b0 */ 0x00, 0x80, 0x8a, 0x00, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x30, 0x3d, 
+/* 0x07c0 */ 0x9c, 0x07, 0xc4, 0x07, 0x80, 0x1b, 0x80, 0x40, 0x04, 0xa5, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 
+/* 0x07d0 */ 0x8a, 0x00, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x31, 0x3d, 0xbc, 0x07, 
+/* 0x07e0 */ 0xe2, 0x07, 0x80, 0x1b, 0x81, 0x40, 0x04, 0xa5, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x07f0 */ 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x30, 0x3d, 0x9c, 0x07, 0x00, 0x08, 
+/* 0x0800 */ 0x80, 0x1b, 0x82, 0x40, 0x04, 0xa5, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x81, 0x02, 
+/* 0x0810 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x3c, 0x3c, 0xf8, 0x07, 0x1e, 0x08, 0x90, 0x1b, 
+/* 0x0820 */ 0x80, 0x1b, 0x89, 0x2d, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x3e, 0x3e, 0x16, 0x08, 
+/* 0x0830 */ 0x32, 0x08, 0x90, 0x1b, 0x80, 0x1b, 0x89, 0x2e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 
+/* 0x0840 */ 0x41, 0x4c, 0x49, 0x47, 0x4e, 0x00, 0x2a, 0x08, 0x4a, 0x08, 0x80, 0x1b, 0x81, 0x1e, 0x80, 0x3e, 
+/* 0x0850 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x44, 0x55, 0x50, 0x00, 0x3e, 0x08, 0x60, 0x08, 
+/* 0x0860 */ 0x80, 0x1b, 0x80, 0x19, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x52, 0x4f, 0x54, 0x00, 
+/* 0x0870 */ 0x56, 0x08, 0x74, 0x08, 0x30, 0x1b, 0x20, 0x1b, 0x10, 0x1b, 0x20, 0x19, 0x30, 0x19, 0x10, 0x19, 
+/* 0x0880 */ 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x4c, 0x52, 0x4f, 0x54, 0x6a, 0x08, 0x8e, 0x08, 0x30, 0x1b, 
+/* 0x0890 */ 0x20, 0x1b, 0x10, 0x1b, 0x30, 0x19, 0x10, 0x19, 0x20, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 
+/* 0x08a0 */ 0x50, 0x49, 0x43, 0x4b, 0x84, 0x08, 0xa8, 0x08, 0x00, 0x1b, 0x1d, 0x01, 0x10, 0x1d, 0x10, 0x1d, 
+/* 0x08b0 */ 0x12, 0x1e, 0x21, 0x06, 0x20, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x53, 0x57, 0x41, 0x50, 
+/* 0x08c0 */ 0x9e, 0x08, 0xc4, 0x08, 0x00, 0x1b, 0x10, 0x1b, 0x00, 0x19, 0x10, 0x19, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x08d0 */ 0x04, 0x80, 0x44, 0x52, 0x4f, 0x50, 0xba, 0x08, 0xda, 0x08, 0x80, 0x1b, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x08e0 */ 0x03, 0x80, 0x4e, 0x49, 0x50, 0x00, 0xd0, 0x08, 0xea, 0x08, 0x80, 0x1b, 0x90, 0x1b, 0x80, 0x19, 
+/* 0x08f0 */ 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x4f, 0x56, 0x45, 0x52, 0xe0, 0x08, 0xfe, 0x08, 0x80, 0x1b, 
+/* 0x0900 */ 0x90, 0x1b, 0x90, 0x19, 0x80, 0x19, 0x90, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x49, 0x00, 
+/* 0x0910 */ 0xf4, 0x08, 0x14, 0x09, 0x80, 0x1c, 0x80, 0x1a, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 
+/* 0x0920 */ 0x4a, 0x00, 0x0c, 0x09, 0x26, 0x09, 0xe3, 0x08, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 
+/* 0x0930 */ 0x4b, 0x00, 0x1e, 0x09, 0x36, 0x09, 0xe5, 0x08, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 
+/* 0x0940 */ 0x2c, 0x00, 0x2e, 0x09, 0x46, 0x09, 0x80, 0x1b, 0x90, 0x03, 0x46, 0x30, 0x99, 0x06, 0x98, 0x10, 
+/* 0x0950 */ 0x92, 0x1e, 0x80, 0x03, 0x46, 0x30, 0x89, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x08, 0x80, 0x43, 0x4f, 
+/* 0x0960 */ 0x4d, 0x50, 0x49, 0x4c, 0x45, 0x2c, 0x3e, 0x09, 0x6a, 0x09, 0x80, 0x03, 0x26, 0x0a, 0x80, 0x19, 
+/* 0x0970 */ 0x1b, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x07, 0xc0, 0x4c, 0x49, 0x54, 0x45, 0x52, 0x41, 0x4c, 0x00, 
+/* 0x0980 */ 0x5c, 0x09, 0x84, 0x09, 0x80, 0x03, 0x26, 0x0a, 0x80, 0x19, 0x1c, 0x45, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0990 */ 0x07, 0x80, 0x42, 0x41, 0x52, 0x52, 0x49, 0x45, 0x52, 0x00, 0x76, 0x09, 0x9e, 0x09, 0x80, 0x02, 
+/* 0x09a0 */ 0x90, 0x03, 0x54, 0x30, 0x98, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x08, 0x80, 0x4f, 0x50, 0x54, 0x49, 
+/* 0x09b0 */ 0x4d, 0x49, 0x5a, 0x45, 0x90, 0x09, 0xb8, 0x09, 0x80, 0x03, 0x52, 0x30, 0x80, 0x19, 0x00, 0x80, 
+/* 0x09c0 */ 0x8a, 0x00, 0x03, 0x80, 0x53, 0x54, 0x43, 0x00, 0xaa, 0x09, 0xcc, 0x09, 0x80, 0x03, 0x60, 0x30, 
+/* 0x09d0 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x49, 0x53, 0x4c, 0x41, 0x4e, 0x44, 0xc2, 0x09, 
+/* 0x09e0 */ 0xe2, 0x09, 0x80, 0x03, 0x26, 0x0a, 0x80, 0x19, 0x1d, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x09, 0x80, 
+/* 0x09f0 */ 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x45, 0x44, 0x3f, 0x00, 0xd6, 0x09, 0xfe, 0x09, 0x80, 0x03, 
+/* 0x0a00 */ 0x26, 0x0a, 0x80, 0x19, 0x22, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x0c, 0x80, 0x49, 0x4e, 0x4c, 0x49, 
+/* 0x0a10 */ 0x4e, 0x45, 0x2d, 0x43, 0x45, 0x4c, 0x4c, 0x53, 0xee, 0x09, 0x1c, 0x0a, 0x80, 0x03, 0x5e, 0x30, 
+/* 0x0a20 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x46, 0x30, 0x52, 0x30, 0x54, 0x30, 0x56, 0x30, 0xae, 0x0f, 
+/* 0x0a30 */ 0x1c, 0x06, 0x46, 0x06, 0x5a, 0x06, 0x84, 0x06, 0x98, 0x06, 0xe2, 0x06, 0x0c, 0x0b, 0x30, 0x0b, 
+/* 0x0a40 */ 0x1e, 0x0b, 0x42, 0x0b, 0xc2, 0x07, 0xc2, 0x08, 0xd8, 0x08, 0xe8, 0x08, 0x86, 0x00, 0x80, 0x00, 
+/* 0x0a50 */ 0x88, 0x11, 0x66, 0x0b, 0xb8, 0x0d, 0x4a, 0x30, 0x5e, 0x30, 0xb6, 0x0a, 0x60, 0x30, 0x62, 0x30, 
+/* 0x0a60 */ 0x4e, 0x30, 0x94, 0x00, 0x9c, 0x00, 0xa0, 0x00, 0x8a, 0x00, 0xa6, 0x0a, 0xb0, 0x0a, 0xce, 0x04, 
+/* 0x0a70 */ 0x5e, 0x08, 0xf8, 0x04, 0xd8, 0x08, 0x3c, 0x0d, 0x44, 0x09, 0xf8, 0x0e, 0xfc, 0x0a, 0x96, 0x0d, 
+/* 0x0a80 */ 0xe2, 0x06, 0x9c, 0x03, 0xd6, 0x0b, 0x9a, 0x0b, 0x60, 0x04, 0xae, 0x06, 0x48, 0x08, 0x54, 0x0d, 
+/* 0x0a90 */ 0x10, 0x0c, 0xd2, 0x0e, 0x12, 0x14, 0x8a, 0x0b, 0x98, 0x06, 0x1c, 0x06, 0x9c, 0x09, 0xbe, 0x03, 
+/* 0x0aa0 */ 0xa0, 0x13, 0x1a, 0x04, 0x00, 0x00, 0x18, 0x0d, 0xcc, 0x15, 0xba, 0x15, 0x76, 0x09, 0x00, 0x00, 
+/* 0x0ab0 */ 0x50, 0x02, 0x4e, 0x0b, 0x00, 0x00, 0x5e, 0x11, 0x76, 0x11, 0x88, 0x11, 0x02, 0x10, 0xa4, 0x11, 
+/* 0x0ac0 */ 0xe6, 0x11, 0x0c, 0x12, 0xb6, 0x10, 0xdc, 0x10, 0xee, 0x10, 0x1e, 0x03, 0x24, 0x15, 0x66, 0x0b, 
+/* 0x0ad0 */ 0x76, 0x0b, 0x12, 0x09, 0x24, 0x09, 0x34, 0x09, 0x00, 0x00, 0x05, 0x80, 0x46, 0x4c, 0x55, 0x53, 
+/* 0x0ae0 */ 0x48, 0x00, 0x0a, 0x0a, 0xe6, 0x0a, 0x85, 0x02, 0x80, 0x19, 0x1e, 0x45, 0x07, 0x45, 0x00, 0x80, 
+/* 0x0af0 */ 0x8a, 0x00, 0x06, 0x80, 0x41, 0x53, 0x50, 0x41, 0x43, 0x45, 0xda, 0x0a, 0xfe, 0x0a, 0x20, 0x04, 
+/* 0x0b00 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x31, 0x2b, 0xf2, 0x0a, 0x0e, 0x0b, 0x80, 0x1b, 
+/* 0x0b10 */ 0x81, 0x1e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x32, 0x2b, 0x06, 0x0b, 0x20, 0x0b, 
+/* 0x0b20 */ 0x80, 0x1b, 0x82, 0x1e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x31, 0x2d, 0x18, 0x0b, 
+/* 0x0b30 */ 0x32, 0x0b, 0x80, 0x1b, 0x8f, 0x1e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x02, 0x80, 0x32, 0x2d, 
+/* 0x0b40 */ 0x2a, 0x0b, 0x44, 0x0b, 0x80, 0x1b, 0x8e, 0x1e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 
+/* 0x0b50 */ 0x53, 0x43, 0x4f, 0x44, 0x45, 0x00, 0x3c, 0x0b, 0x80, 0x00, 0x66, 0x0b, 0x84, 0x0d, 0x86, 0x00, 
+/* 0x0b60 */ 0x02, 0x80, 0x52, 0x3e, 0x4e, 0x0b, 0x68, 0x0b, 0x80, 0x1c, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0b70 */ 0x02, 0x80, 0x3e, 0x52, 0x60, 0x0b, 0x78, 0x0b, 0x80, 0x1b, 0x80, 0x1a, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0b80 */ 0x05, 0x80, 0x45, 0x4e, 0x54, 0x52, 0x59, 0x00, 0x70, 0x0b, 0x80, 0x00, 0x3c, 0x0d, 0xce, 0x04, 
+/* 0x0b90 */ 0xce, 0x04, 0x86, 0x00, 0x02, 0x80, 0x44, 0x50, 0x80, 0x0b, 0x9c, 0x0b, 0x80, 0x03, 0x46, 0x30, 
+/* 0x0ba0 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x44, 0x50, 0x21, 0x00, 0x94, 0x0b, 0xb0, 0x0b, 
+/* 0x0bb0 */ 0x80, 0x03, 0x46, 0x30, 0x90, 0x1b, 0x89, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x4c, 0x42, 
+/* 0x0bc0 */ 0x55, 0x46, 0xa6, 0x0b, 0xc6, 0x0b, 0x80, 0x03, 0x02, 0x30, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0bd0 */ 0x02, 0x80, 0x32, 0x2b, 0xbc, 0x0b, 0xd8, 0x0b, 0x80, 0x1b, 0x82, 0x1e, 0x80, 0x19, 0x00, 0x80, 
+/* 0x0be0 */ 0x8a, 0x00, 0x05, 0x80, 0x57, 0x41, 0x3e, 0x4c, 0x41, 0x00, 0xd0, 0x0b, 0xee, 0x0b, 0x80, 0x1b, 
+/* 0x0bf0 */ 0x98, 0x01, 0x89, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x80, 0x29, 0x89, 0x1d, 0x83, 0x1e, 0x80, 0x3e, 
+/* 0x0c00 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x57, 0x41, 0x3e, 0x43, 0x41, 0x00, 0xe2, 0x0b, 
+/* 0x0c10 */ 0x12, 0x0c, 0x80, 0x1b, 0x98, 0x01, 0x89, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x80, 0x29, 0x89, 0x1d, 
+/* 0x0c20 */ 0x85, 0x1e, 0x80, 0x3e, 0x09, 0x06, 0x0c, 0x3c, 0x01, 0xa5, 0x88, 0x06, 0x80, 0x19, 0x00, 0x80, 
+/* 0x0c30 */ 0x8a, 0x00, 0x05, 0x80, 0x57, 0x41, 0x3e, 0x43, 0x42, 0x00, 0x06, 0x0c, 0x3e, 0x0c, 0x80, 0x1b, 
+/* 0x0c40 */ 0x98, 0x01, 0x89, 0x06, 0x00, 0x03, 0xff, 0x0f, 0x80, 0x29, 0x89, 0x1d, 0x85, 0x1e, 0x80, 0x3e, 
+/* 0x0c50 */ 0x09, 0x06, 0x0c, 0x3c, 0x01, 0xa5, 0x88, 0x06, 0x82, 0x1e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0c60 */ 0x05, 0x80, 0x43, 0x41, 0x3e, 0x57, 0x41, 0x00, 0x32, 0x0c, 0x80, 0x00, 0xae, 0x0f, 0x02, 0x00, 
+/* 0x0c70 */ 0x46, 0x06, 0xae, 0x0f, 0x40, 0x00, 0xc2, 0x08, 0xc2, 0x08, 0x5e, 0x08, 0xae, 0x0f, 0x00, 0x00, 
+/* 0x0c80 */ 0xe2, 0x06, 0xae, 0x06, 0x5e, 0x11, 0xb4, 0x0c, 0xae, 0x0f, 0x01, 0x00, 0x46, 0x06, 0xc2, 0x08, 
+/* 0x0c90 */ 0xae, 0x0f, 0x02, 0x00, 0x46, 0x06, 0x5e, 0x08, 0xce, 0x04, 0xae, 0x0f, 0x00, 0x80, 0x84, 0x06, 
+/* 0x0ca0 */ 0x5e, 0x11, 0xac, 0x0c, 0xae, 0x0f, 0x01, 0x00, 0x76, 0x11, 0xb0, 0x0c, 0xae, 0x0f, 0x00, 0x00, 
+/* 0x0cb0 */ 0x76, 0x11, 0xd2, 0x0c, 0xd8, 0x08, 0xd8, 0x08, 0xae, 0x0f, 0x00, 0x00, 0x1e, 0x03, 0x0d, 0x00, 
+/* 0x0cc0 */ 0x2d, 0x2d, 0x20, 0x55, 0x4e, 0x4b, 0x4e, 0x4f, 0x57, 0x4e, 0x20, 0x2d, 0x2d, 0x00, 0xae, 0x0f, 
+/* 0x0cd0 */ 0x00, 0x00, 0x02, 0x10, 0x78, 0x0c, 0xc2, 0x08, 0xd8, 0x08, 0x86, 0x00, 0x06, 0x80, 0x43, 0x52, 
+/* 0x0ce0 */ 0x45, 0x41, 0x54, 0x45, 0x60, 0x0c, 0x80, 0x00, 0x8a, 0x0b, 0xfc, 0x0a, 0xf8, 0x0e, 0x96, 0x0d, 
+/* 0x0cf0 */ 0x3c, 0x0d, 0xce, 0x04, 0xf8, 0x04, 0x5e, 0x08, 0xae, 0x0f, 0x00, 0x80, 0x98, 0x06, 0x96, 0x0d, 
+/* 0x0d00 */ 0xf8, 0x04, 0x96, 0x0d, 0x1c, 0x06, 0xd6, 0x0b, 0x48, 0x08, 0x9a, 0x0b, 0xf8, 0x04, 0x44, 0x09, 
+/* 0x0d10 */ 0x96, 0x0d, 0xd6, 0x0b, 0x44, 0x09, 0x86, 0x00, 0x01, 0xe0, 0x3b, 0x00, 0xdc, 0x0c, 0x80, 0x00, 
+/* 0x0d20 */ 0xae, 0x0f, 0x86, 0x00, 0x68, 0x09, 0xae, 0x0f, 0x00, 0x00, 0x60, 0x04, 0xf8, 0x04, 0x86, 0x00, 
+/* 0x0d30 */ 0x07, 0x80, 0x43, 0x55, 0x52, 0x52, 0x45, 0x4e, 0x54, 0x00, 0x18, 0x0d, 0x3e, 0x0d, 0x80, 0x03, 
+/* 0x0d40 */ 0x4a, 0x30, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 0x43, 0x4f, 0x4e, 0x54, 0x45, 0x58, 
+/* 0x0d50 */ 0x54, 0x00, 0x30, 0x0d, 0x56, 0x0d, 0x80, 0x03, 0x48, 0x30, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0d60 */ 0x0b, 0x80, 0x44, 0x45, 0x46, 0x49, 0x4e, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x53, 0x00, 0x48, 0x0d, 
+/* 0x0d70 */ 0x80, 0x00, 0x54, 0x0d, 0xce, 0x04, 0x3c, 0x0d, 0xf8, 0x04, 0x86, 0x00, 0x03, 0x80, 0x43, 0x41, 
+/* 0x0d80 */ 0x21, 0x00, 0x60, 0x0d, 0x80, 0x00, 0x8a, 0x0b, 0x10, 0x0c, 0xf8, 0x04, 0x86, 0x00, 0x04, 0x80, 
+/* 0x0d90 */ 0x48, 0x45, 0x52, 0x45, 0x7c, 0x0d, 0x98, 0x0d, 0x80, 0x03, 0x46, 0x30, 0x98, 0x06, 0x90, 0x19, 
+/* 0x0da0 */ 0x00, 0x80, 0x8a, 0x00, 0x08, 0x80, 0x43, 0x4f, 0x4e, 0x53, 0x54, 0x41, 0x4e, 0x54, 0x8e, 0x0d, 
+/* 0x0db0 */ 0x80, 0x00, 0xe6, 0x0c, 0x44, 0x09, 0x58, 0x0b, 0x8c, 0x06, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0dc0 */ 0x0e, 0x80, 0x48, 0x45, 0x41, 0x44, 0x45, 0x52, 0x2d, 0x54, 0x4f, 0x2d, 0x4d, 0x4f, 0x44, 0x45, 
+/* 0x0dd0 */ 0xa4, 0x0d, 0xd4, 0x0d, 0x80, 0x1b, 0x90, 0x03, 0x0f, 0x00, 0x89, 0x35, 0x90, 0x03, 0x0d, 0x00, 
+/* 0x0de0 */ 0x89, 0x2e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x08, 0x80, 0x3f, 0x45, 0x58, 0x45, 0x43, 0x55, 
+/* 0x0df0 */ 0x54, 0x45, 0xc0, 0x0d, 0x80, 0x00, 0x5e, 0x08, 0xce, 0x04, 0xd2, 0x0d, 0xae, 0x0f, 0x02, 0x00, 
+/* 0x0e00 */ 0x1c, 0x08, 0x60, 0x04, 0xce, 0x04, 0x98, 0x06, 0x5e, 0x08, 0xae, 0x0f, 0x00, 0x00, 0xe2, 0x06, 
+/* 0x0e10 */ 0x5e, 0x11, 0x1c, 0x0e, 0xd8, 0x08, 0xd2, 0x0e, 0x76, 0x11, 0xa2, 0x0e, 0x5e, 0x08, 0xae, 0x0f, 
+/* 0x0e20 */ 0x01, 0x00, 0xe2, 0x06, 0x5e, 0x11, 0x46, 0x0e, 0xd8, 0x08, 0x5e, 0x08, 0xfc, 0x09, 0x5e, 0x11, 
+/* 0x0e30 */ 0x3e, 0x0e, 0xd8, 0x08, 0xae, 0x0f, 0xf0, 0x01, 0x9c, 0x03, 0x76, 0x11, 0x9a, 0x0e, 0x10, 0x0c, 
+/* 0x0e40 */ 0x68, 0x09, 0x76, 0x11, 0xa2, 0x0e, 0x5e, 0x08, 0xae, 0x0f, 0x02, 0x00, 0xe2, 0x06, 0x5e, 0x11, 
+/* 0x0e50 */ 0x5a, 0x0e, 0xd8, 0x08, 0xd2, 0x0e, 0x76, 0x11, 0xa2, 0x0e, 0x5e, 0x08, 0xae, 0x0f, 0x03, 0x00, 
+/* 0x0e60 */ 0xe2, 0x06, 0x5e, 0x11, 0x70, 0x0e, 0xae, 0x0f, 0x4e, 0x01, 0x9c, 0x03, 0x76, 0x11, 0x9a, 0x0e, 
+/* 0x0e70 */ 0x5e, 0x08, 0xae, 0x0f, 0x04, 0x00, 0xe2, 0x06, 0x5e, 0x11, 0x86, 0x0e, 0xae, 0x0f, 0x24, 0x01, 
+/* 0x0e80 */ 0x9c, 0x03, 0x76, 0x11, 0x9a, 0x0e, 0xd8, 0x08, 0x5e, 0x08, 0xe0, 0x09, 0xd2, 0x0e, 0x9c, 0x09, 
+/* 0x0e90 */ 0x76, 0x11, 0xa2, 0x0e, 0xae, 0x0f, 0x78, 0x01, 0x9c, 0x03, 0xae, 0x0f, 0x00, 0x00, 0x76, 0x11, 
+/* 0x0ea0 */ 0xa8, 0x0e, 0x5a, 0x03, 0xae, 0x0f, 0x01, 0x00, 0x86, 0x00, 0x07, 0x80, 0x3f, 0x4e, 0x55, 0x4d, 
+/* 0x0eb0 */ 0x42, 0x45, 0x52, 0x00, 0xe8, 0x0d, 0xb8, 0x0e, 0x80, 0x03, 0x46, 0x30, 0x88, 0x06, 0x80, 0x19, 
+/* 0x0ec0 */ 0x08, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x45, 0x00, 
+/* 0x0ed0 */ 0xaa, 0x0e, 0xd4, 0x0e, 0x90, 0x1b, 0x89, 0x06, 0xc0, 0x03, 0xff, 0x0f, 0xc8, 0x29, 0xc9, 0x1d, 
+/* 0x0ee0 */ 0xc5, 0x1e, 0xc0, 0x3e, 0x8c, 0x3c, 0x01, 0xa5, 0xcc, 0x06, 0x00, 0x80, 0x8e, 0x00, 0x05, 0x80, 
+/* 0x0ef0 */ 0x54, 0x4f, 0x4b, 0x45, 0x4e, 0x00, 0xc6, 0x0e, 0xfa, 0x0e, 0x80, 0x03, 0x64, 0x30, 0x88, 0x06, 
+/* 0x0f00 */ 0x80, 0x40, 0x36, 0xb5, 0x90, 0x1b, 0x10, 0x02, 0x30, 0x02, 0x00, 0x03, 0x02, 0x30, 0x00, 0x06, 
+/* 0x0f10 */ 0x20, 0x03, 0x04, 0x30, 0x22, 0x06, 0x20, 0x3f, 0x28, 0xa5, 0x27, 0xa1, 0x20, 0x04, 0x98, 0x3f, 
+/* 0x0f20 */ 0x07, 0xb5, 0x20, 0x3f, 0x0f, 0xa5, 0x80, 0x07, 0x89, 0x3f, 0x02, 0xb5, 0x01, 0x1e, 0xf9, 0x81, 
+/* 0x0f30 */ 0x20, 0x3f, 0x08, 0xa5, 0x80, 0x07, 0x89, 0x3f, 0x05, 0xa5, 0x0a, 0x41, 0x03, 0xa5, 0x01, 0x1e, 
+/* 0x0f40 */ 0x11, 0x1e, 0xf6, 0x81, 0x10, 0x40, 0x11, 0xa5, 0x80, 0x03, 0x46, 0x30, 0x98, 0x06, 0x91, 0x10, 
+/* 0x0f50 */ 0x31, 0x01, 0x92, 0x1e, 0x01, 0x22, 0x80, 0x07, 0x98, 0x11, 0x01, 0x1e, 0x91, 0x1e, 0x1f, 0x1e, 
+/* 0x0f60 */ 0xfa, 0xb5, 0x80, 0x03, 0x02, 0x30, 0x01, 0x1e, 0x80, 0x10, 0x30, 0x19, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x0f70 */ 0x80, 0x03, 0x46, 0x30, 0x88, 0x06, 0x80, 0x19, 0x83, 0x02, 0x80, 0x19, 0x00, 0x80, 0x62, 0x18, 
+/* 0x0f80 */ 0x06, 0x80, 0x49, 0x4e, 0x4c, 0x49, 0x4e, 0x45, 0xee, 0x0e, 0x8c, 0x0f, 0x80, 0x03, 0x02, 0x30, 
+/* 0x0f90 */ 0x80, 0x19, 0x06, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x04, 0x80, 0x49, 0x44, 0x4c, 0x45, 0x80, 0x0f, 
+/* 0x0fa0 */ 0xa2, 0x0f, 0x21, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x02, 0xc0, 0x2a, 0x23, 0x98, 0x0f, 0xb0, 0x0f, 
+/* 0x0fb0 */ 0x8a, 0x06, 0x80, 0x19, 0xa2, 0x1e, 0x00, 0x80, 0x8a, 0x00, 0x05, 0xc0, 0x42, 0x45, 0x47, 0x49, 
+/* 0x0fc0 */ 0x4e, 0x00, 0xa8, 0x0f, 0xc6, 0x0f, 0x80, 0x03, 0x46, 0x30, 0x88, 0x06, 0x80, 0x19, 0x00, 0x80, 
+/* 0x0fd0 */ 0x8a, 0x00, 0x05, 0xc0, 0x55, 0x4e, 0x54, 0x49, 0x4c, 0x00, 0xba, 0x0f, 0xde, 0x0f, 0x00, 0x1b, 
+/* 0x0fe0 */ 0x10, 0x03, 0x02, 0x10, 0x20, 0x03, 0x46, 0x30, 0x32, 0x06, 0x31, 0x10, 0x32, 0x1e, 0x30, 0x10, 
+/* 0x0ff0 */ 0x32, 0x1e, 0x23, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x06, 0xa0, 0x2a, 0x55, 0x4e, 0x54, 0x49, 0x4c, 
+/* 0x1000 */ 0xd2, 0x0f, 0x04, 0x10, 0x80, 0x1b, 0x80, 0x40, 0x03, 0xb5, 0xaa, 0x06, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x1010 */ 0xa2, 0x1e, 0x00, 0x80, 0x8a, 0x00, 0x04, 0xc0, 0x43, 0x41, 0x53, 0x45, 0xf8, 0x0f, 0x80, 0x00, 
+/* 0x1020 */ 0xae, 0x0f, 0x00, 0x00, 0x86, 0x00, 0x02, 0xc0, 0x4f, 0x46, 0x16, 0x10, 0x2e, 0x10, 0x30, 0x1b, 
+/* 0x1030 */ 0x31, 0x1e, 0x00, 0x03, 0xb6, 0x10, 0x10, 0x03, 0x46, 0x30, 0x21, 0x06, 0x20, 0x10, 0x22, 0x1e, 
+/* 0x1040 */ 0x20, 0x19, 0x30, 0x19, 0x22, 0x1e, 0x12, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x05, 0xc0, 0x45, 0x4e, 
+/* 0x1050 */ 0x44, 0x4f, 0x46, 0x00, 0x26, 0x10, 0x58, 0x10, 0x30, 0x1b, 0x20, 0x1b, 0x00, 0x03, 0x46, 0x30, 
+/* 0x1060 */ 0x10, 0x06, 0x14, 0x1e, 0x21, 0x10, 0x80, 0x03, 0xdc, 0x10, 0x1c, 0x1e, 0x18, 0x10, 0x12, 0x1e, 
+/* 0x1070 */ 0x10, 0x19, 0x30, 0x19, 0x12, 0x1e, 0x01, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x04, 0xc0, 0x45, 0x53, 
+/* 0x1080 */ 0x41, 0x43, 0x4c, 0x10, 0x86, 0x10, 0x00, 0x1b, 0x10, 0x03, 0x46, 0x30, 0x11, 0x06, 0x20, 0x03, 
+/* 0x1090 */ 0xee, 0x10, 0x12, 0x10, 0x12, 0x1e, 0x20, 0x03, 0x46, 0x30, 0x21, 0x10, 0x1e, 0x1e, 0x00, 0x29, 
+/* 0x10a0 */ 0x04, 0xa5, 0x0f, 0x1e, 0x20, 0x1b, 0x21, 0x10, 0xfa, 0x81, 0x00, 0x80, 0x8a, 0x00, 0x03, 0xa0, 
+/* 0x10b0 */ 0x2a, 0x4f, 0x46, 0x00, 0x7c, 0x10, 0xb8, 0x10, 0x80, 0x1b, 0x90, 0x1b, 0x89, 0x3f, 0x04, 0xa5, 
+/* 0x10c0 */ 0x90, 0x19, 0xaa, 0x06, 0x00, 0x80, 0x8a, 0x00, 0xa2, 0x1e, 0x00, 0x80, 0x8a, 0x00, 0x09, 0xa0, 
+/* 0x10d0 */ 0x2a, 0x4f, 0x46, 0x5f, 0x45, 0x4e, 0x44, 0x4f, 0x46, 0x00, 0xae, 0x10, 0xde, 0x10, 0xaa, 0x06, 
+/* 0x10e0 */ 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x2a, 0x45, 0x53, 0x41, 0x43, 0x00, 0xce, 0x10, 0xf0, 0x10, 
+/* 0x10f0 */ 0x00, 0x80, 0x8a, 0x00, 0x02, 0xc0, 0x49, 0x46, 0xe4, 0x10, 0xfc, 0x10, 0x00, 0x03, 0x5e, 0x11, 
+/* 0x1100 */ 0x10, 0x03, 0x46, 0x30, 0x21, 0x06, 0x20, 0x10, 0x22, 0x1e, 0x20, 0x19, 0x22, 0x1e, 0x12, 0x10, 
+/* 0x1110 */ 0x00, 0x80, 0x8a, 0x00, 0x04, 0xc0, 0x45, 0x4c, 0x53, 0x45, 0xf4, 0x10, 0x1e, 0x11, 0x20, 0x1b, 
+/* 0x1120 */ 0x00, 0x03, 0x46, 0x30, 0x10, 0x06, 0x14, 0x1e, 0x21, 0x10, 0x80, 0x03, 0x76, 0x11, 0x1c, 0x1e, 
+/* 0x1130 */ 0x18, 0x10, 0x12, 0x1e, 0x10, 0x19, 0x12, 0x1e, 0x01, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x04, 0xc0, 
+/* 0x1140 */ 0x54, 0x48, 0x45, 0x4e, 0x14, 0x11, 0x48, 0x11, 0x80, 0x1b, 0x90, 0x03, 0x46, 0x30, 0x99, 0x06, 
+/* 0x1150 */ 0x89, 0x10, 0x00, 0x80, 0x8a, 0x00, 0x03, 0xa0, 0x2a, 0x49, 0x46, 0x00, 0x3e, 0x11, 0x60, 0x11, 
+/* 0x1160 */ 0x80, 0x1b, 0x80, 0x40, 0x09, 0xa5, 0xa2, 0x1e, 0x00, 0x80, 0x8a, 0x00, 0x05, 0xa0, 0x2a, 0x45, 
+/* 0x1170 */ 0x4c, 0x53, 0x45, 0x00, 0x56, 0x11, 0x78, 0x11, 0xaa, 0x06, 0x00, 0x80, 0x8a, 0x00, 0x05, 0xa0, 
+/* 0x1180 */ 0x2a, 0x54, 0x41, 0x49, 0x4c, 0x00, 0x6c, 0x11, 0x78, 0x11, 0x02, 0xc0, 0x44, 0x4f, 0x7e, 0x11, 
+/* 0x1190 */ 0x80, 0x00, 0xae, 0x0f, 0xa4, 0x11, 0x44, 0x09, 0x96, 0x0d, 0x86, 0x00, 0x03, 0xa0, 0x2a, 0x44, 
+/* 0x11a0 */ 0x4f, 0x00, 0x8a, 0x11, 0xa6, 0x11, 0x80, 0x1b, 0x90, 0x1b, 0x90, 0x1a, 0x80, 0x1a, 0x00, 0x80, 
+/* 0x11b0 */ 0x8a, 0x00, 0x04, 0xc0, 0x4c, 0x4f, 0x4f, 0x50, 0x9c, 0x11, 0x80, 0x00, 0xae, 0x0f, 0xe6, 0x11, 
+/* 0x11c0 */ 0x44, 0x09, 0x44, 0x09, 0x86, 0x00, 0x05, 0xc0, 0x2b, 0x4c, 0x4f, 0x4f, 0x50, 0x00, 0xb2, 0x11, 
+/* 0x11d0 */ 0x80, 0x00, 0xae, 0x0f, 0x0c, 0x12, 0x44, 0x09, 0x44, 0x09, 0x86, 0x00, 0x05, 0xa0, 0x2a, 0x4c, 
+/* 0x11e0 */ 0x4f, 0x4f, 0x50, 0x00, 0xc6, 0x11, 0xe8, 0x11, 0x80, 0x1c, 0x90, 0x1c, 0x81, 0x1e, 0x89, 0x3f, 
+/* 0x11f0 */ 0x03, 0xa1, 0xa2, 0x1e, 0x00, 0x80, 0x8a, 0x00, 0x90, 0x1a, 0x80, 0x1a, 0xaa, 0x06, 0x00, 0x80, 
+/* 0x1200 */ 0x8a, 0x00, 0x06, 0xa0, 0x2a, 0x2b, 0x4c, 0x4f, 0x4f, 0x50, 0xdc, 0x11, 0x0e, 0x12, 0x80, 0x1c, 
+/* 0x1210 */ 0x90, 0x1c, 0x00, 0x1b, 0x80, 0x1d, 0xeb, 0x81, 0x03, 0x80, 0x3f, 0x53, 0x50, 0x00, 0x02, 0x12, 
+/* 0x1220 */ 0x22, 0x12, 0xd0, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x80, 0x3f, 0x52, 0x53, 0x00, 0x18, 0x12, 
+/* 0x1230 */ 0x32, 0x12, 0xe0, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x50, 0x41, 0x54, 0x43, 0x48, 0x00, 
+/* 0x1240 */ 0x28, 0x12, 0x80, 0x00, 0x60, 0x04, 0xce, 0x04, 0x5e, 0x11, 0x60, 0x12, 0x3c, 0x0d, 0xce, 0x04, 
+/* 0x1250 */ 0xce, 0x04, 0x5e, 0x08, 0xae, 0x0b, 0xec, 0x0b, 0xce, 0x04, 0x3c, 0x0d, 0xce, 0x04, 0xf8, 0x04, 
+/* 0x1260 */ 0x4e, 0x03, 0x86, 0x00, 0x05, 0x80, 0x4f, 0x55, 0x54, 0x45, 0x52, 0x00, 0x38, 0x12, 0x80, 0x00, 
+/* 0x1270 */ 0xae, 0x0f, 0xfc, 0x00, 0x9c, 0x03, 0xbe, 0x13, 0xae, 0x0f, 0x96, 0x01, 0x9c, 0x03, 0x8a, 0x0f, 
+/* 0x1280 */ 0x5e, 0x08, 0xc2, 0x07, 0x5e, 0x11, 0x94, 0x12, 0xd8, 0x08, 0xae, 0x0f, 0x0a, 0x00, 0xa0, 0x0f, 
+/* 0x1290 */ 0x76, 0x11, 0x7e, 0x12, 0xfe, 0x07, 0x5e, 0x11, 0x9e, 0x12, 0x76, 0x11, 0x76, 0x12, 0xb8, 0x12, 
+/* 0x12a0 */ 0x76, 0x11, 0x76, 0x12, 0x86, 0x00, 0x0e, 0x80, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53, 0x53, 0x2d, 
+/* 0x12b0 */ 0x54, 0x4f, 0x4b, 0x45, 0x4e, 0x53, 0x64, 0x12, 0x80, 0x00, 0xfc, 0x0a, 0xf8, 0x0e, 0x5e, 0x11, 
+/* 0x12c0 */ 0xfe, 0x12, 0x12, 0x14, 0x5e, 0x11, 0xda, 0x12, 0xf4, 0x0d, 0xae, 0x06, 0x5e, 0x11, 0xd6, 0x12, 
+/* 0x12d0 */ 0x42, 0x12, 0x76, 0x11, 0xfe, 0x12, 0x76, 0x11, 0xba, 0x12, 0xb6, 0x0e, 0x5e, 0x11, 0xee, 0x12, 
+/* 0x12e0 */ 0x60, 0x04, 0xce, 0x04, 0x5e, 0x11, 0xea, 0x12, 0x82, 0x09, 0x76, 0x11, 0xba, 0x12, 0xae, 0x0f, 
+/* 0x12f0 */ 0x14, 0x01, 0x9c, 0x03, 0x9a, 0x0b, 0xce, 0x04, 0x9c, 0x03, 0x76, 0x11, 0xba, 0x12, 0x86, 0x00, 
+/* 0x1300 */ 0x04, 0x80, 0x54, 0x52, 0x41, 0x50, 0xa6, 0x12, 0x0a, 0x13, 0x8f, 0x01, 0x04, 0x1f, 0x07, 0x81, 
+/* 0x1310 */ 0x0e, 0x00, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x21, 0x80, 0x19, 
+/* 0x1320 */ 0x01, 0x45, 0x00, 0x46, 0x00, 0x80, 0x8a, 0x00, 0x08, 0x80, 0x57, 0x4f, 0x52, 0x44, 0x2d, 0x4c, 
+/* 0x1330 */ 0x45, 0x4e, 0x00, 0x13, 0x36, 0x13, 0x80, 0x1b, 0x88, 0x06, 0x8f, 0x3e, 0x8e, 0x3e, 0x8d, 0x3e, 
+/* 0x1340 */ 0x8c, 0x3e, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x2e, 0x57, 0x4f, 0x52, 0x44, 0x00, 
+/* 0x1350 */ 0x28, 0x13, 0x54, 0x13, 0x00, 0x1b, 0x10, 0x06, 0x1f, 0x3e, 0x1e, 0x3e, 0x1d, 0x3e, 0x1c, 0x3e, 
+/* 0x1360 */ 0x02, 0x1e, 0x20, 0x07, 0x20, 0x19, 0x05, 0x45, 0x01, 0x1e, 0x1f, 0x1e, 0xfa, 0xb5, 0x00, 0x80, 
+/* 0x1370 */ 0x8a, 0x00, 0x06, 0x80, 0x2e, 0x53, 0x57, 0x4f, 0x52, 0x44, 0x48, 0x13, 0x80, 0x00, 0x52, 0x13, 
+/* 0x1380 */ 0x82, 0x13, 0x84, 0x13, 0x00, 0x1b, 0x01, 0x1e, 0x00, 0x3e, 0x02, 0x23, 0xd0, 0x1d, 0x00, 0x80, 
+/* 0x1390 */ 0x88, 0x00, 0x09, 0x80, 0x4e, 0x45, 0x58, 0x54, 0x2d, 0x57, 0x4f, 0x52, 0x44, 0x00, 0x72, 0x13, 
+/* 0x13a0 */ 0x80, 0x00, 0x5e, 0x08, 0xce, 0x04, 0xae, 0x0f, 0xff, 0x0f, 0x84, 0x06, 0x1c, 0x06, 0xd6, 0x0b, 
+/* 0x13b0 */ 0x48, 0x08, 0xce, 0x04, 0x86, 0x00, 0x04, 0x80, 0x43, 0x52, 0x45, 0x54, 0x92, 0x13, 0xc0, 0x13, 
+/* 0x13c0 */ 0x80, 0x03, 0x0a, 0x00, 0x80, 0x19, 0x05, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x57, 0x4f, 
+/* 0x13d0 */ 0x52, 0x44, 0x53, 0x00, 0xb6, 0x13, 0x80, 0x00, 0x3c, 0x0d, 0xce, 0x04, 0xce, 0x04, 0x5e, 0x08, 
+/* 0x13e0 */ 0x52, 0x13, 0xfc, 0x0a, 0xbe, 0x03, 0xa0, 0x13, 0x5e, 0x08, 0xae, 0x06, 0x5e, 0x11, 0xde, 0x13, 
+/* 0x13f0 */ 0xd8, 0x08, 0x86, 0x00, 0x07, 0x80, 0x43, 0x4f, 0x4d, 0x50, 0x41, 0x52, 0x45, 0x00, 0xcc, 0x13, 
+/* 0x1400 */ 0x02, 0x14, 0x16, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 
+/* 0x1410 */ 0xf4, 0x13, 0x14, 0x14, 0x80, 0x03, 0x46, 0x30, 0x08, 0x06, 0x10, 0x06, 0x02, 0x1e, 0x60, 0x01, 
+/* 0x1420 */ 0x50, 0x03, 0x4a, 0x30, 0x55, 0x06, 0x55, 0x06, 0x35, 0x06, 0x3f, 0x3e, 0x3e, 0x3e, 0x3d, 0x3e, 
+/* 0x1430 */ 0x3c, 0x3e, 0x31, 0x3f, 0x0a, 0xa5, 0x53, 0x1d, 0x53, 0x1e, 0x50, 0x3e, 0x55, 0x06, 0x55, 0x29, 
+/* 0x1440 */ 0xf3, 0xb5, 0x80, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x26, 0x01, 0x45, 0x01, 0x42, 0x1e, 
+/* 0x1450 */ 0x71, 0x01, 0x82, 0x07, 0x94, 0x07, 0x89, 0x3f, 0xee, 0xb5, 0x21, 0x1e, 0x41, 0x1e, 0x7f, 0x1e, 
+/* 0x1460 */ 0xf8, 0xb5, 0x50, 0x19, 0x81, 0x02, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x3a, 0x00, 
+/* 0x1470 */ 0x08, 0x14, 0x80, 0x00, 0x3c, 0x0d, 0xce, 0x04, 0x54, 0x0d, 0xf8, 0x04, 0xe6, 0x0c, 0xae, 0x0f, 
+/* 0x1480 */ 0x80, 0x00, 0xca, 0x09, 0xce, 0x04, 0x5e, 0x11, 0x90, 0x14, 0xd8, 0x08, 0xae, 0x0f, 0x94, 0x00, 
+/* 0x1490 */ 0x84, 0x0d, 0x9c, 0x09, 0xae, 0x0f, 0x01, 0x00, 0x60, 0x04, 0xf8, 0x04, 0x86, 0x00, 0x02, 0xc0, 
+/* 0x14a0 */ 0x2e, 0x22, 0x6c, 0x14, 0x80, 0x00, 0xae, 0x0f, 0x1e, 0x03, 0x44, 0x09, 0xae, 0x0f, 0x22, 0x00, 
+/* 0x14b0 */ 0xf8, 0x0e, 0xd6, 0x0b, 0x48, 0x08, 0x9a, 0x0b, 0x30, 0x06, 0x86, 0x00, 0x02, 0xe0, 0x53, 0x22, 
+/* 0x14c0 */ 0x9e, 0x14, 0x80, 0x00, 0x60, 0x04, 0xce, 0x04, 0x5e, 0x11, 0xe4, 0x14, 0xae, 0x0f, 0x24, 0x15, 
+/* 0x14d0 */ 0x44, 0x09, 0xae, 0x0f, 0x22, 0x00, 0xf8, 0x0e, 0xd6, 0x0b, 0x48, 0x08, 0x9a, 0x0b, 0x30, 0x06, 
+/* 0x14e0 */ 0x76, 0x11, 0x1a, 0x15, 0xae, 0x0f, 0x22, 0x00, 0xf8, 0x0e, 0xd8, 0x08, 0xee, 0x14, 0xf0, 0x14, 
+/* 0x14f0 */ 0x00, 0x03, 0x46, 0x30, 0x10, 0x06, 0x31, 0x06, 0x33, 0x1e, 0x30, 0x3e, 0x23, 0x01, 0xd3, 0x22, 
+/* 0x1500 */ 0xd2, 0x1e, 0x41, 0x06, 0xd4, 0x10, 0x12, 0x1e, 0xd2, 0x1e, 0x2e, 0x1e, 0xfa, 0xb5, 0xd3, 0x22, 
+/* 0x1510 */ 0x5d, 0x01, 0xde, 0x1e, 0x50, 0x19, 0x00, 0x80, 0x88, 0x00, 0x86, 0x00, 0x03, 0xa0, 0x2a, 0x53, 
+/* 0x1520 */ 0x22, 0x00, 0xbc, 0x14, 0x26, 0x15, 0x8a, 0x01, 0x9a, 0x06, 0xa9, 0x1d, 0xa3, 0x1e, 0xa0, 0x3e, 
+/* 0x1530 */ 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0x80, 0x3f, 0x00, 0x1c, 0x15, 0x80, 0x00, 0x1e, 0x03, 
+/* 0x1540 */ 0x01, 0x00, 0x3f, 0x00, 0x4e, 0x03, 0x86, 0x00, 0x01, 0x80, 0x27, 0x00, 0x36, 0x15, 0x80, 0x00, 
+/* 0x1550 */ 0xfc, 0x0a, 0xf8, 0x0e, 0xd8, 0x08, 0x12, 0x14, 0xae, 0x06, 0x5e, 0x11, 0x60, 0x15, 0x3c, 0x15, 
+/* 0x1560 */ 0x10, 0x0c, 0x86, 0x00, 0x02, 0x80, 0x4e, 0x27, 0x48, 0x15, 0x80, 0x00, 0xfc, 0x0a, 0xf8, 0x0e, 
+/* 0x1570 */ 0xd8, 0x08, 0x12, 0x14, 0xae, 0x06, 0x5e, 0x11, 0x7c, 0x15, 0x36, 0x15, 0x86, 0x00, 0x06, 0x80, 
+/* 0x1580 */ 0x46, 0x4f, 0x52, 0x47, 0x45, 0x54, 0x64, 0x15, 0x80, 0x00, 0x3c, 0x0d, 0xce, 0x04, 0x54, 0x0d, 
+/* 0x1590 */ 0xf8, 0x04, 0x6a, 0x15, 0x5e, 0x08, 0xa0, 0x13, 0x3c, 0x0d, 0xce, 0x04, 0xf8, 0x04, 0x9a, 0x0b, 
+/* 0x15a0 */ 0xf8, 0x04, 0x86, 0x00, 0x05, 0x80, 0x53, 0x54, 0x41, 0x54, 0x45, 0x00, 0x7e, 0x15, 0xb0, 0x15, 
+/* 0x15b0 */ 0x80, 0x03, 0x50, 0x30, 0x80, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x01, 0xe0, 0x5c, 0x00, 0xa4, 0x15, 
+/* 0x15c0 */ 0x80, 0x00, 0xae, 0x0f, 0x5c, 0x00, 0xf8, 0x0e, 0xd8, 0x08, 0x86, 0x00, 0x01, 0xe0, 0x28, 0x00, 
+/* 0x15d0 */ 0xba, 0x15, 0x80, 0x00, 0xae, 0x0f, 0x29, 0x00, 0xf8, 0x0e, 0xd8, 0x08, 0x86, 0x00, 0x06, 0x80, 
+/* 0x15e0 */ 0x43, 0x53, 0x50, 0x4c, 0x49, 0x54, 0xcc, 0x15, 0xea, 0x15, 0x80, 0x1b, 0x98, 0x01, 0x00, 0x03, 
+/* 0x15f0 */ 0xff, 0x00, 0x80, 0x29, 0x98, 0x37, 0x80, 0x19, 0x90, 0x19, 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 
+/* 0x1600 */ 0x2e, 0x32, 0x42, 0x59, 0x54, 0x45, 0x53, 0x00, 0xde, 0x15, 0x80, 0x00, 0xe8, 0x15, 0xc2, 0x08, 
+/* 0x1610 */ 0x1a, 0x04, 0xfc, 0x0a, 0xbe, 0x03, 0x1a, 0x04, 0x86, 0x00, 0x04, 0x80, 0x44, 0x55, 0x4d, 0x50, 
+/* 0x1620 */ 0xde, 0x15, 0x80, 0x00, 0xfc, 0x08, 0x1c, 0x06, 0xc2, 0x08, 0xa4, 0x11, 0x12, 0x09, 0xce, 0x04, 
+/* 0x1630 */ 0x12, 0x09, 0xf8, 0x03, 0xfc, 0x0a, 0xbe, 0x03, 0x5e, 0x08, 0xe8, 0x15, 0xc2, 0x08, 0x1a, 0x04, 
+/* 0x1640 */ 0xfc, 0x0a, 0xbe, 0x03, 0x1a, 0x04, 0xe8, 0x15, 0xc2, 0x08, 0xfc, 0x0a, 0xbe, 0x03, 0xbe, 0x03, 
+/* 0x1650 */ 0xfc, 0x0a, 0xbe, 0x03, 0xbe, 0x03, 0xbe, 0x13, 0xae, 0x0f, 0x02, 0x00, 0x0c, 0x12, 0x2c, 0x16, 
+/* 0x1660 */ 0x86, 0x00, 0x0b, 0x80, 0x46, 0x52, 0x45, 0x45, 0x2d, 0x4d, 0x45, 0x4d, 0x4f, 0x52, 0x59, 0x00, 
+/* 0x1670 */ 0x1a, 0x16, 0x74, 0x16, 0x17, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x09, 0x80, 0x52, 0x4f, 0x4d, 0x2d, 
+/* 0x1680 */ 0x43, 0x41, 0x43, 0x48, 0x45, 0x00, 0x62, 0x16, 0x8a, 0x16, 0x1a, 0x45, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x1690 */ 0x08, 0x80, 0x2a, 0x41, 0x52, 0x44, 0x55, 0x49, 0x4e, 0x4f, 0x7a, 0x16, 0x9e, 0x16, 0x19, 0x45, 
+/* 0x16a0 */ 0x00, 0x80, 0x8a, 0x00, 0x07, 0x80, 0x53, 0x59, 0x53, 0x43, 0x41, 0x4c, 0x4c, 0x00, 0x90, 0x16, 
+/* 0x16b0 */ 0xb2, 0x16, 0x18, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x46, 0x4f, 0x50, 0x45, 0x4e, 0x00, 
+/* 0x16c0 */ 0xa4, 0x16, 0xc4, 0x16, 0x28, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x46, 0x43, 0x4c, 0x4f, 
+/* 0x16d0 */ 0x53, 0x45, 0xb8, 0x16, 0xd6, 0x16, 0x29, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x46, 0x52, 
+/* 0x16e0 */ 0x45, 0x41, 0x44, 0x00, 0xca, 0x16, 0xe8, 0x16, 0x80, 0x03, 0x02, 0x30, 0x80, 0x19, 0x2a, 0x45, 
+/* 0x16f0 */ 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x46, 0x57, 0x52, 0x49, 0x54, 0x45, 0xdc, 0x16, 0x00, 0x17, 
+/* 0x1700 */ 0x2b, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x46, 0x53, 0x45, 0x45, 0x4b, 0x00, 0xf4, 0x16, 
+/* 0x1710 */ 0x12, 0x17, 0x2c, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x05, 0x80, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x00, 
+/* 0x1720 */ 0x06, 0x17, 0x24, 0x17, 0x80, 0x02, 0x80, 0x19, 0x1e, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 
+/* 0x1730 */ 0x42, 0x55, 0x46, 0x46, 0x45, 0x52, 0x18, 0x17, 0x3a, 0x17, 0x81, 0x02, 0x80, 0x19, 0x1e, 0x45, 
+/* 0x1740 */ 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x55, 0x50, 0x44, 0x41, 0x54, 0x45, 0x2e, 0x17, 0x50, 0x17, 
+/* 0x1750 */ 0x82, 0x02, 0x80, 0x19, 0x1e, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x0c, 0x80, 0x53, 0x41, 0x56, 0x45, 
+/* 0x1760 */ 0x2d, 0x42, 0x55, 0x46, 0x46, 0x45, 0x52, 0x53, 0x44, 0x17, 0x6c, 0x17, 0x83, 0x02, 0x80, 0x19, 
+/* 0x1770 */ 0x1e, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x0d, 0x80, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x2d, 0x42, 0x55, 
+/* 0x1780 */ 0x46, 0x46, 0x45, 0x52, 0x53, 0x00, 0x5a, 0x17, 0x8a, 0x17, 0x84, 0x02, 0x80, 0x19, 0x1e, 0x45, 
+/* 0x1790 */ 0x00, 0x80, 0x8a, 0x00, 0x06, 0x80, 0x3c, 0x46, 0x52, 0x41, 0x4d, 0x45, 0x76, 0x17, 0xa0, 0x17, 
+/* 0x17a0 */ 0x80, 0x02, 0x90, 0x03, 0x8a, 0x30, 0x90, 0x19, 0x80, 0x19, 0x20, 0x45, 0x00, 0x80, 0x8a, 0x00, 
+/* 0x17b0 */ 0x02, 0x80, 0x46, 0x2c, 0x94, 0x17, 0xb8, 0x17, 0x81, 0x02, 0x00, 0x80, 0xa2, 0x17, 0x03, 0x80, 
+/* 0x17c0 */ 0x46, 0x44, 0x2c, 0x00, 0xb0, 0x17, 0xc8, 0x17, 0x82, 0x02, 0x00, 0x80, 0xa2, 0x17, 0x06, 0x80, 
+/* 0x17d0 */ 0x46, 0x52, 0x41, 0x4d, 0x45, 0x3e, 0xbe, 0x17, 0xda, 0x17, 0x83, 0x02, 0x00, 0x80, 0xa2, 0x17, 
+/* 0x17e0 */ 0x04, 0x80, 0x46, 0x45, 0x4f, 0x46, 0xce, 0x17, 0x80, 0x00, 0xae, 0x0f, 0xff, 0xff, 0x86, 0x00, 
+/* 0x17f0 */ 0x09, 0x80, 0x52, 0x45, 0x41, 0x44, 0x5f, 0x46, 0x49, 0x4c, 0x45, 0x00, 0xe0, 0x17, 0x80, 0x00, 
+/* 0x1800 */ 0xae, 0x0f, 0x64, 0x30, 0xce, 0x04, 0x76, 0x0b, 0xae, 0x0f, 0x00, 0x00, 0xae, 0x0f, 0x64, 0x30, 
+/* 0x1810 */ 0xf8, 0x04, 0xae, 0x0f, 0x00, 0x00, 0xc2, 0x16, 0x5e, 0x11, 0x2c, 0x18, 0xe6, 0x16, 0xe8, 0x17, 
+/* 0x1820 */ 0x02, 0x07, 0x5e, 0x11, 0x44, 0x18, 0xb8, 0x12, 0x76, 0x11, 0x1c, 0x18, 0x1e, 0x03, 0x10, 0x00, 
+/* 0x1830 */ 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x66, 0x69, 0x6c, 0x65, 
+/* 0x1840 */ 0x76, 0x11, 0x4a, 0x18, 0xae, 0x0f, 0x00, 0x00, 0xd4, 0x16, 0x66, 0x0b, 0xae, 0x0f, 0x64, 0x30, 
+/* 0x1850 */ 0xf8, 0x04, 0x86, 0x00, 0x07, 0x80, 0x2a, 0x53, 0x4f, 0x55, 0x52, 0x43, 0x45, 0x00, 0xf0, 0x17, 
+/* 0x1860 */ 0x62, 0x18, 0x90, 0x03, 0x64, 0x30, 0x89, 0x06, 0x80, 0x19, 0x2d, 0x45, 0x80, 0x1b, 0x98, 0x10, 
+/* 0x1870 */ 0x00, 0x80, 0x8a, 0x00, 0x0b, 0x80, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x5f, 0x46, 0x49, 0x4c, 
+/* 0x1880 */ 0x45, 0x00, 0x54, 0x18, 0x80, 0x00, 0xae, 0x0f, 0x00, 0x00, 0x60, 0x18, 0x5e, 0x11, 0xa0, 0x18, 
+/* 0x1890 */ 0xae, 0x0f, 0x01, 0x00, 0x60, 0x18, 0x5e, 0x11, 0xb8, 0x18, 0xb8, 0x12, 0x76, 0x11, 0x90, 0x18, 
+/* 0x18a0 */ 0x1e, 0x03, 0x10, 0x00, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20, 
+/* 0x18b0 */ 0x66, 0x69, 0x6c, 0x65, 0x76, 0x11, 0xbe, 0x18, 0xae, 0x0f, 0x02, 0x00, 0x60, 0x18, 0x86, 0x00, 
+/* 0x18c0 */ 0x09, 0x80, 0x57, 0x52, 0x49, 0x54, 0x45, 0x2d, 0x43, 0x50, 0x50, 0x00, 0x74, 0x18, 0xd0, 0x18, 
+/* 0x18d0 */ 0x00, 0x03, 0x4a, 0x30, 0x10, 0x06, 0x11, 0x06, 0x20, 0x03, 0x0a, 0x00, 0x22, 0x1e, 0x21, 0x10, 
+/* 0x18e0 */ 0x15, 0x45, 0x00, 0x80, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 /* 0x18f0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 /* 0x1900 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 /* 0x1910 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -569,5 +613,5 @@ const uint8_t rom[8192] PROGMEM = {
 /* 0x1fc0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 /* 0x1fd0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 /* 0x1fe0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-/* 0x1ff0 */ 0x00, 0x00, 0x01, 0x00, 0x21, 0x50, 0x31, 0x34, 0x31, 0x36, 0x43, 0x50, 0x50, 0x00, 0x86, 0x00}; // rom
+/* 0x1ff0 */ 0x00, 0x00, 0x05, 0xe0, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x00, 0xc0, 0x18, 0x80, 0x00, 0x86, 0x00}; // rom
 #endif // UKMAKER_FORTH_IMAGE_H
@@ -4,11 +4,50 @@
 #include "Memory.h"
 #include "FArduino.h"
 #include "ForthIS.h"
+#include "ForthConfiguration.h"
+#if VM_JIT
+#include <string.h>
+#endif
+#if NATIVE_STACK_CELLS > 0
+#include "NativeStack.h"
+#endif
 
 class ForthVM; 
 
+// Jumps are only tracked when something looks their targets up
+#define VM_JUMP_HOOKS (VM_NATIVE || VM_JIT)
+
+// Trap numbers pushed for the stack trap handler
+#define STACK_TRAP_DS_UNDERFLOW 0
+#define STACK_TRAP_RS_UNDERFLOW 1
+#define STACK_TRAP_DS_OVERFLOW 2
+#define STACK_TRAP_RS_OVERFLOW 3
+
 typedef void (*Syscall)(ForthVM *vm);
 
+// A block of VM code translated to C++ by Dumper::writeNative
+// Runs the block and returns the address it leaves for
+typedef uint16_t (*NativeCode)(ForthVM *vm);
+
+struct NativeEntry {
+    uint16_t addr;
+    NativeCode code;
+};
+
+// The blocks of one image, Image is a tag type named by the Dumper
+template<typename Image> struct ForthNative;
+
+#if VM_JIT
+// Translates hot code on the host, see tools/TraceJIT.h
+class ForthJit {
+    public:
+    // Run the translation starting at addr, @return false if there is none
+    virtual bool enter(ForthVM *vm, uint16_t addr) = 0;
+    // Jumps keep landing on addr
+    virtual void translate(ForthVM *vm, uint16_t addr) = 0;
+};
+#endif
+
 class ForthVM
 {
 
@@ -17,20 +56,62 @@ public:
     :
     _ram(ram), _syscalls(syscalls), _numSyscalls(numSyscalls)
     {
+#if VM_NATIVE
+        _native = NULL;
+        _numNative = 0;
+#endif
+#if VM_JIT
+        _jit = NULL;
+#endif
+        _jump(false);
         _halted = true;
+        _trapPending = false;
+        _stackTrap = 0;
+        _hasStackTrap = false;
+        _dsLimit = _rsLimit = 0;
+        _dsTop = _rsTop = 0xffff;
     }
 
     ~ForthVM() {}
 
     bool halted() {
-        return _halted;
+        return _halted && !_trapPending;
+    }
+
+    void halt() {
+        _halted = true;
     }
 
     void reset() {
         _regs[REG_PC] = 0;
         _halted = false;
+        _trapPending = false;
+        _jump(true);
     }
 
+    /**
+     * Run translated code in place of the VM code at the given addresses.
+     * The table must be sorted by address and match the image exactly.
+     * It is only consulted when a jump lands, so a block runs as one step.
+     */
+#if VM_NATIVE
+    void setNative(const NativeEntry *table, uint16_t count) {
+        _native = table;
+        _numNative = count;
+    }
+#endif
+
+#if VM_JIT
+    /**
+     * Hand hot jump targets to the JIT, NULL to stop. The JIT must see
+     * every store to the memory so it can drop stale translations.
+     */
+    void setJit(ForthJit *jit) {
+        _jit = jit;
+        memset(_heat, 0, sizeof(_heat));
+    }
+#endif
+
     void step() {
         _clock();
     }
@@ -45,6 +126,9 @@ public:
 
     void set(uint8_t reg, uint16_t v) {
         _regs[reg] = v;
+        if(reg == REG_PC) {
+            _jump(true);
+        }
     }
 
     bool getC() {
@@ -79,30 +163,104 @@ public:
     }
 
     void push(uint16_t c) {
-        _ram->put(_regs[REG_SP], (uint16_t)c);
-        _regs[REG_SP]-=2;
+        _pushd(c);
     }
 
     uint16_t pop() {
-        _regs[REG_SP]+=2;
-        return _ram->get(_regs[REG_SP]);
+        return _popd();
     }
 
     uint8_t readByte(uint16_t addr) {
-        return _ram->getC(addr);
+        return _getC(addr);
     }
 
     uint16_t read(uint16_t addr) {
-        return _ram->get(addr);
+        return _get(addr);
     }
 
+    /**
+     * Direct access to VM memory. The stacks are synced first so that
+     * callers see them in RAM.
+     */
     Memory *ram() {
+        syncStacks();
         return _ram;
     }
 
+    /**
+     * Hold the top of the data and return stacks in native arrays.
+     * Each stack is given as its lowest cell and its top cell.
+     */
+    void setNativeStacks(uint16_t dsLimit, uint16_t dsTop, uint16_t rsLimit, uint16_t rsTop) {
+#if NATIVE_STACK_CELLS > 0
+        syncStacks();
+        _ds.attach(dsLimit, dsTop);
+        _rs.attach(rsLimit, rsTop);
+#endif
+    }
+
+    void clearNativeStacks() {
+#if NATIVE_STACK_CELLS > 0
+        _ds.detach(_ram, _regs[REG_SP]);
+        _rs.detach(_ram, _regs[REG_RS]);
+#endif
+    }
+
+    /**
+     * Bound both stacks. Each is given as its lowest cell and its top cell.
+     * A push below the lowest cell or a pop above the top cell resets both
+     * stacks, pushes a STACK_TRAP_ number and continues at the stack trap
+     * address, or halts the VM if there is none.
+     */
+    void setStackBounds(uint16_t dsLimit, uint16_t dsTop, uint16_t rsLimit, uint16_t rsTop) {
+        _dsLimit = dsLimit;
+        _dsTop = dsTop;
+        _rsLimit = rsLimit;
+        _rsTop = rsTop;
+    }
+
+    void setStackTrap(uint16_t addr) {
+        _stackTrap = addr;
+        _hasStackTrap = true;
+    }
+
+    // Write any natively held stack cells back to VM RAM
+    void syncStacks() {
+#if NATIVE_STACK_CELLS > 0
+        _ds.spill(_ram, _regs[REG_SP]);
+        _rs.spill(_ram, _regs[REG_RS]);
+#endif
+    }
+
     protected:
 
+    template<typename Image> friend struct ForthNative;
+    friend class TraceJIT;
+
+#if VM_NATIVE
+    const NativeEntry *_native;
+    uint16_t _numNative;
+#endif
+#if VM_JUMP_HOOKS
+    bool _jumped; // PC was just set by a jump, see _clock
+#endif
+#if VM_JIT
+    ForthJit *_jit;
+    uint8_t _heat[JIT_HEAT_SLOTS];
+#endif
+
     bool _halted;
+    bool _trapPending;
+    uint8_t _trapNumber;
+    bool _hasStackTrap;
+    uint16_t _stackTrap;
+    uint16_t _dsLimit, _dsTop;
+    uint16_t _rsLimit, _rsTop;
+
+#if NATIVE_STACK_CELLS > 0
+    NativeStack _ds;
+    NativeStack _rs;
+#endif
 
     Memory *_ram;
     Syscall *_syscalls;
@@ -121,9 +279,45 @@ public:
     void _clock()
     {
         if(_halted) {
-            return;
+            // A trap halts the VM until the instruction raising it is done
+            if(!_trapPending) {
+                return;
+            }
+            _enterTrap();
+            if(_halted) {
+                return; // No trap vector, stay halted
+            }
+            _jump(true);
         }
 
+#if VM_JUMP_HOOKS
+        if(_jumped) {
+            _jumped = false;
+#if VM_NATIVE
+            NativeCode code = _nativeAt(_regs[REG_PC]);
+            if(code != NULL) {
+                _regs[REG_PC] = code(this);
+                _jumped = true;
+                return;
+            }
+#endif
+#if VM_JIT
+            if(_jit != NULL) {
+                uint16_t pc = _regs[REG_PC];
+                if(_jit->enter(this, pc)) {
+                    _jumped = true;
+                    return;
+                }
+                uint8_t *heat = &_heat[(pc >> 1) & (JIT_HEAT_SLOTS - 1)];
+                if(++*heat == JIT_HOT) {
+                    *heat = 0;
+                    _jit->translate(this, pc);
+                }
+            }
+#endif
+        }
+#endif
+
         bool ccapply = false;
         bool ccinvert = false;
         uint8_t cc = 0;
@@ -175,6 +369,7 @@ public:
             
             case OP_MOV:   
                 _regs[arga] = _regs[argb]; 
+                _jump(arga == REG_PC);
                 break; // Ra <- Rb
 
             case OP_MOVI:  
@@ -194,99 +389,95 @@ public:
                 break;         // Ra <- #num6
 
             case OP_LD:
-                _regs[arga] = _ram->get(_regs[argb]);
+                _regs[arga] = _get(_regs[argb]);
                 break;
 
             case OP_LD_B:
-                _regs[arga] = _ram->getC(_regs[argb]);
+                _regs[arga] = _getC(_regs[argb]);
                 break;
 
             case OP_LDAX:
-                _regs[REG_A] = _ram->get(_regs[arga] + (n4 << 1));
+                _regs[REG_A] = _get(_regs[arga] + (n4 << 1));
                 break;
 
             case OP_LDBX:
-                _regs[REG_B] = _ram->get(_regs[arga] + (n4 << 1));
+                _regs[REG_B] = _get(_regs[arga] + (n4 << 1));
                 break;
 
             case OP_LDAX_B:
-                _regs[REG_A] = _ram->getC(_regs[arga] + (n4 << 1));
+                _regs[REG_A] = _getC(_regs[arga] + (n4 << 1));
                 break;
 
             case OP_LDBX_B:
-                _regs[REG_B] = _ram->getC(_regs[arga] + (n4 << 1));
+                _regs[REG_B] = _getC(_regs[arga] + (n4 << 1));
                 break;
 
             case OP_ST:
-                _ram->put(_regs[arga], _regs[argb]);
+                _put(_regs[arga], _regs[argb]);
                 break; // (Ra) <- Rb
 
            case OP_ST_B:
-                _ram->putC(_regs[arga], _regs[argb]);
+                _putC(_regs[arga], _regs[argb]);
                 break; // (Ra) <- Rb
 
             case OP_STI:
-                _ram->put(_regs[arga], n4);
+                _put(_regs[arga], n4);
                 break; // (Ra) <- #num3
 
             case OP_STAI:
-                _ram->put(_regs[REG_A], n8);
+                _put(_regs[REG_A], n8);
                 break; // (Ra) <- #num6
 
            case OP_STBI:
-                _ram->putC(_regs[REG_B], n8);
+                _putC(_regs[REG_B], n8);
                 break; // (Ra) <- #num6
 
             case OP_STIL:
-                _ram->put(arga, getIL());
+                _put(arga, getIL());
                 break;
 
             case OP_STI_B:
-                _ram->putC(_regs[arga], n4);
+                _putC(_regs[arga], n4);
                 break; // (Ra) <- #num3
 
             case OP_STAI_B:
-                _ram->putC(_regs[REG_A], n8);
+                _putC(_regs[REG_A], n8);
                 break; // (Ra) <- #num6
 
            case OP_STBI_B:
-                _ram->putC(_regs[REG_B], n8);
+                _putC(_regs[REG_B], n8);
                 break; // (Ra) <- #num6
 
             case OP_STXA:
-                _ram->put(_regs[arga] + (n4 << 1), _regs[REG_A]);
+                _put(_regs[arga] + (n4 << 1), _regs[REG_A]);
                 break;
 
             case OP_STXB:
-                _ram->put(_regs[arga] + (n4 << 1), _regs[REG_B]);
+                _put(_regs[arga] + (n4 << 1), _regs[REG_B]);
                 break;
 
             case OP_STXA_B:
-                _ram->putC(_regs[arga] + n4, _regs[REG_A]);
+                _putC(_regs[arga] + n4, _regs[REG_A]);
                 break;
 
             case OP_STXB_B:
-                _ram->putC(_regs[arga] + n4, _regs[REG_B]);
+                _putC(_regs[arga] + n4, _regs[REG_B]);
                 break;
 
             case OP_PUSHD:
-                _ram->put(_regs[REG_SP], _regs[arga]);
-                _regs[REG_SP]-=2;
+                _pushd(_regs[arga]);
                 break; // DSTACK <- Ra, INC SP
 
             case OP_PUSHR:
-                _ram->put(_regs[REG_RS], _regs[arga]);
-                _regs[REG_RS]-=2;
+                _pushr(_regs[arga]);
                 break; // RSTACK <- Ra, INC RS
 
             case OP_POPD:
-                _regs[REG_SP]+=2;
-                _regs[arga] = _ram->get(_regs[REG_SP]);
+                _regs[arga] = _popd();
                 break; // DEC SP, Ra <- DSTACK
 
             case OP_POPR:
-                _regs[REG_RS]+=2;
-                _regs[arga] = _ram->get(_regs[REG_RS]);
+                _regs[arga] = _popr();
                 break; // DEC RS, Ra <- RSTACK
 
             case OP_ADD: _add(arga, argb); break;
@@ -340,55 +531,75 @@ public:
 
             case OP_JR:
                 if(!skip) _regs[REG_PC] = _regs[REG_PC] + (n8 << 1);
+                _jump(!skip);
                 break;  // PC <- PC + #n6
 
             case OP_JP:
-                if(!skip) _regs[REG_PC] = _ram->get(_regs[REG_PC]);
+                {
+                    // Step over the address even when the jump is not taken
+                    uint16_t target = getIL();
+                    if(!skip) _regs[REG_PC] = target;
+                    _jump(!skip);
+                }
                 break; // PC <- #num16
 
             case OP_JX:
                 if(!skip) _regs[REG_PC] = _regs[arga] + (n4 << 1);
+                _jump(!skip);
                 break; // PC <- Ra + #num16
 
             case OP_JXL:
-                if(!skip) _regs[REG_PC] = _regs[arga] + getIL();
+                {
+                    uint16_t offset = getIL();
+                    if(!skip) _regs[REG_PC] = _regs[arga] + offset;
+                    _jump(!skip);
+                }
                 break;
 
+            // Calls push the return address on the return stack like PUSHR
             case OP_CALL: // PC <- #num16
-                if(!skip)  {
-                    _regs[REG_PC] = _ram->get(_regs[REG_PC]);
-                    _regs[REG_PC]+=2;
-                    _ram->put(_regs[REG_RS], _regs[REG_PC]);
-                    _regs[REG_RS]+=2;
+                {
+                    uint16_t target = getIL();
+                    if(!skip)  {
+                        _pushr(_regs[REG_PC]);
+                        _regs[REG_PC] = target;
+                    }
                 }
+                _jump(!skip);
                 break;
 
             case OP_CALLR:
                 if(!skip)  {
-                    _ram->put(_regs[REG_RS], _regs[REG_PC]);
+                    _pushr(_regs[REG_PC]);
                     _regs[REG_PC] = _regs[REG_PC] + (n8 << 1);
                 }
-                break; // PC <- PC + #num6
+                _jump(!skip);
+                break; // PC <- PC + #num8.0
 
            case OP_CALLX:
                 if(!skip) {
-                    _ram->put(_regs[REG_RS], _regs[REG_PC]);
-                    _regs[REG_PC] = _regs[arga] + (n8 << 1);
+                    _pushr(_regs[REG_PC]);
+                    _regs[REG_PC] = _regs[arga] + (n4 << 1);
                 }
-                break; // PC <- PC + #num6
+                _jump(!skip);
+                break; // PC <- Ra + #num4.0
 
            case OP_CALLXL:
-                if(!skip)  {
-                    _ram->put(_regs[REG_RS], _regs[REG_PC]);
-                    _regs[REG_PC] = _regs[arga] + getIL();
+                {
+                    uint16_t offset = getIL();
+                    if(!skip)  {
+                        _pushr(_regs[REG_PC]);
+                        _regs[REG_PC] = _regs[arga] + offset;
+                    }
                 }
-                break; // PC <- PC + #num6
+                _jump(!skip);
+                break; // PC <- Ra + #num16
 
             case OP_RET:
                 if(!skip)  {
-                    _regs[REG_RS]-=2;
-                    _regs[REG_PC] = _ram->get(_regs[REG_RS]);
+                    _regs[REG_PC] = _popr();
                 }
+                _jump(!skip);
                 break;
 
             case OP_SYSCALL:
@@ -404,6 +615,138 @@ public:
             
     }
 
+    // Note whether PC was just set by a jump, for _clock's lookups
+    void _jump(bool jumped) {
+#if VM_JUMP_HOOKS
+        _jumped = jumped;
+#else
+        (void)jumped;
+#endif
+    }
+
+#if VM_NATIVE
+    NativeCode _nativeAt(uint16_t addr) {
+        uint16_t lo = 0;
+        uint16_t hi = _numNative;
+        while(lo < hi) {
+            uint16_t mid = (lo + hi) >> 1;
+            if(_native[mid].addr < addr) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return (lo < _numNative && _native[lo].addr == addr) ? _native[lo].code : NULL;
+    }
+#endif
+
+    /**
+     * Data access to VM memory. With native stacks the window being
+     * accessed is spilled to RAM first.
+     */
+    void _touch(uint16_t addr) {
+#if NATIVE_STACK_CELLS > 0
+        _ds.touch(_ram, addr, _regs[REG_SP]);
+        _rs.touch(_ram, addr, _regs[REG_RS]);
+#endif
+    }
+
+    uint16_t _get(uint16_t addr) {
+        _touch(addr);
+        return _ram->get(addr);
+    }
+
+    uint8_t _getC(uint16_t addr) {
+        _touch(addr);
+        return _ram->getC(addr);
+    }
+
+    void _put(uint16_t addr, uint16_t v) {
+        _touch(addr);
+        _ram->put(addr, v);
+    }
+
+    void _putC(uint16_t addr, uint8_t c) {
+        _touch(addr);
+        _ram->putC(addr, c);
+    }
+
+    /**
+     * Raised on the push/pop paths. The trap is entered at the start of
+     * the next cycle so the current instruction or syscall can finish.
+     */
+    void _trap(uint8_t n) {
+        if(!_trapPending) {
+            _trapNumber = n;
+        }
+        _trapPending = true;
+        _halted = true;
+    }
+
+    void _enterTrap() {
+        _trapPending = false;
+        if(!_hasStackTrap) {
+            return;
+        }
+        _halted = false;
+        _regs[REG_SP] = _dsTop;
+        _regs[REG_RS] = _rsTop;
+        _pushd(_trapNumber);
+        _regs[REG_PC] = _stackTrap;
+    }
+
+    void _pushd(uint16_t v) {
+        if(_regs[REG_SP] < _dsLimit) {
+            _trap(STACK_TRAP_DS_OVERFLOW);
+            return;
+        }
+#if NATIVE_STACK_CELLS > 0
+        _ds.put(_ram, _regs[REG_SP], v);
+#else
+        _ram->put(_regs[REG_SP], v);
+#endif
+        _regs[REG_SP]-=2;
+    }
+
+    uint16_t _popd() {
+        _regs[REG_SP]+=2;
+        if(_regs[REG_SP] > _dsTop) {
+            _trap(STACK_TRAP_DS_UNDERFLOW);
+            return 0;
+        }
+#if NATIVE_STACK_CELLS > 0
+        return _ds.get(_ram, _regs[REG_SP]);
+#else
+        return _ram->get(_regs[REG_SP]);
+#endif
+    }
+
+    void _pushr(uint16_t v) {
+        if(_regs[REG_RS] < _rsLimit) {
+            _trap(STACK_TRAP_RS_OVERFLOW);
+            return;
+        }
+#if NATIVE_STACK_CELLS > 0
+        _rs.put(_ram, _regs[REG_RS], v);
+#else
+        _ram->put(_regs[REG_RS], v);
+#endif
+        _regs[REG_RS]-=2;
+    }
+
+    uint16_t _popr() {
+        _regs[REG_RS]+=2;
+        if(_regs[REG_RS] > _rsTop) {
+            _trap(STACK_TRAP_RS_UNDERFLOW);
+            return 0;
+        }
+#if NATIVE_STACK_CELLS > 0
+        return _rs.get(_ram, _regs[REG_RS]);
+#else
+        return _ram->get(_regs[REG_RS]);
+#endif
+    }
+
     void _add(uint8_t a, uint8_t b) {
         uint32_t r = (uint32_t)_regs[a] + (uint32_t)_regs[b];
         _regs[a] = r & 0xffff;
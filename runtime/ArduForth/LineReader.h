@@ -0,0 +1,149 @@
+#ifndef UKMAKER_LINE_READER_H
+#define UKMAKER_LINE_READER_H
+
+#include "FArduino.h"
+#include "ForthConfiguration.h"
+#include "Memory.h"
+#include "FSerial.h"
+#if defined(ARDUINO) && defined(__AVR__)
+#include <avr/sleep.h>
+#endif
+
+/**
+ * Console input for INLINE that never waits.
+ *
+ * Received bytes go into a small ring, either from an interrupt or
+ * serialEvent() handler calling receive(), or from poll() which moves
+ * whatever the serial port already holds. line() then adds them to the
+ * line being built in VM memory and reports it only once a newline
+ * arrives or the line is full, so the outer interpreter can keep looping
+ * (and the sketch keep running) while the user types.
+ *
+ * wait() is for the times the loop has nothing to do: it sleeps until a
+ * byte arrives or a timeout passes, so an idle VM isn't spinning.
+ */
+
+class LineReader {
+
+    public:
+
+    LineReader() : _head(0), _tail(0), _buf(0), _len(0) {}
+    ~LineReader() {}
+
+    /**
+     * Queue a received byte, safe to call from an interrupt handler
+     * @return false if the ring is full and the byte was dropped
+     */
+    bool receive(uint8_t c) {
+        uint8_t next = (_head + 1) & (INLINE_RING - 1);
+        if(next == _tail) {
+            return false;
+        }
+        _ring[_head] = c;
+        _head = next;
+        return true;
+    }
+
+    // Move the bytes waiting at the serial port into the ring, up to a newline
+    void poll() {
+        while(!_full() && Serial.available()) {
+            int c = Serial.read();
+            if(c < 0) {
+                c = 0x0a; // End of input on the host ends the line
+            }
+            receive(c);
+            if(c == 0x0a) {
+                break;
+            }
+        }
+    }
+
+    /**
+     * Sleep until there is input or ms have passed
+     * @return true if there is input
+     */
+    bool wait(uint16_t ms) {
+        if(_tail != _head) {
+            return true;
+        }
+        #ifdef ARDUINO
+        uint32_t start = millis();
+        while(_tail == _head && !Serial.available()) {
+            if(millis() - start >= ms) {
+                return false;
+            }
+            _sleep();
+        }
+        return true;
+        #else
+        return Serial.wait(ms);
+        #endif
+    }
+
+    // Next byte from the ring, or the serial port when it is empty
+    int read() {
+        if(_tail == _head) {
+            return Serial.read();
+        }
+        uint8_t c = _ring[_tail];
+        _tail = (_tail + 1) & (INLINE_RING - 1);
+        return c;
+    }
+
+    /**
+     * Add the queued bytes to the line at buf, at most max long.
+     * A different buf starts a new line.
+     * @return the length of a complete line, or -1 if there is none yet
+     */
+    int16_t line(Memory *mem, uint16_t buf, uint8_t max) {
+        if(buf != _buf) {
+            _buf = buf;
+            _len = 0;
+        }
+        while(_tail != _head) {
+            uint8_t c = _ring[_tail];
+            _tail = (_tail + 1) & (INLINE_RING - 1);
+            if(c == 0x0a) {
+                return _done();
+            }
+            mem->putC(buf + _len, c);
+            if(++_len == max) {
+                return _done();
+            }
+        }
+        return -1;
+    }
+
+    protected:
+
+    uint8_t _ring[INLINE_RING];
+    volatile uint8_t _head;
+    volatile uint8_t _tail;
+    uint16_t _buf;
+    uint8_t _len;
+
+    #ifdef ARDUINO
+    // Until the next interrupt, the RX or a timer tick, whichever is first
+    void _sleep() {
+        #if defined(__AVR__)
+        set_sleep_mode(SLEEP_MODE_IDLE);
+        sleep_mode();
+        #elif defined(__arm__)
+        __WFI();
+        #else
+        yield();
+        #endif
+    }
+    #endif
+
+    bool _full() {
+        return ((_head + 1) & (INLINE_RING - 1)) == _tail;
+    }
+
+    int16_t _done() {
+        int16_t len = _len;
+        _len = 0;
+        return len;
+    }
+};
+#endif
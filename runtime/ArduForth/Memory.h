@@ -33,6 +33,17 @@ class Memory {
 
     virtual uint16_t *addressOfWord(uint16_t location)=0;
 
+    // True if len bytes from addr lie in RAM, so that addressOfChar(addr)
+    // can be read directly as one block
+    virtual bool inRam(uint16_t addr, uint16_t len) {
+        return addr >= _ramStart && (uint32_t)addr + len <= (uint32_t)_ramStart + _ramSize;
+    }
+
+    // ROM cache statistics, zero where there is no cache
+    virtual uint32_t romCacheHits() { return 0; }
+
+    virtual uint32_t romCacheMisses() { return 0; }
+
     protected:
 
     uint8_t *_ram;
@@ -0,0 +1,121 @@
+#ifndef UKMAKER_NATIVE_STACK_H
+#define UKMAKER_NATIVE_STACK_H
+
+#include "Memory.h"
+#include "ForthConfiguration.h"
+
+/**
+ * Holds the top NATIVE_STACK_CELLS cells of a downward growing stack in a
+ * native array so that pushes and pops do not go through Memory.
+ *
+ * The stack pointer register still holds VM addresses; the array is just
+ * where cells in the window live while the stack is not spilled. Before
+ * anything reads or writes the window through Memory the live cells are
+ * spilled back to RAM, and the next push or pop reloads them.
+ */
+class NativeStack {
+
+    public:
+
+    NativeStack() : _enabled(false), _spilled(true), _base(0), _top(0), _bytes(0) {}
+
+    ~NativeStack() {}
+
+    /**
+     * limit is the lowest cell of the stack region, top the first cell used
+     */
+    void attach(uint16_t limit, uint16_t top) {
+        uint16_t cells = ((top - limit) >> 1) + 1;
+        if(cells > NATIVE_STACK_CELLS) {
+            cells = NATIVE_STACK_CELLS;
+        }
+        _top = top;
+        _bytes = cells << 1;
+        _base = top - _bytes + 2;
+        _spilled = true;
+        _enabled = cells > 0;
+    }
+
+    void detach(Memory *mem, uint16_t sp) {
+        spill(mem, sp);
+        _enabled = false;
+    }
+
+    bool enabled() {
+        return _enabled;
+    }
+
+    bool spilled() {
+        return _spilled;
+    }
+
+    // True if addr lies in the window held by the array
+    bool holds(uint16_t addr) {
+        return (uint16_t)(addr - _base) < _bytes;
+    }
+
+    void put(Memory *mem, uint16_t addr, uint16_t v) {
+        if(_enabled && holds(addr)) {
+            if(_spilled) {
+                _reload(mem, (uint32_t)addr + 2);
+            }
+            _cells[(_top - addr) >> 1] = v;
+        } else {
+            mem->put(addr, v);
+        }
+    }
+
+    uint16_t get(Memory *mem, uint16_t addr) {
+        if(_enabled && holds(addr)) {
+            if(_spilled) {
+                _reload(mem, addr);
+            }
+            return _cells[(_top - addr) >> 1];
+        }
+        return mem->get(addr);
+    }
+
+    /**
+     * Called before addr is accessed through Memory
+     */
+    void touch(Memory *mem, uint16_t addr, uint16_t sp) {
+        if(_enabled && !_spilled && holds(addr)) {
+            spill(mem, sp);
+        }
+    }
+
+    /**
+     * Write the live cells above sp back to RAM, which then stays current
+     * until the next push or pop
+     */
+    void spill(Memory *mem, uint16_t sp) {
+        if(!_enabled || _spilled) {
+            return;
+        }
+        for(uint32_t addr = _first((uint32_t)sp + 2); addr <= _top; addr += 2) {
+            mem->put(addr, _cells[(_top - addr) >> 1]);
+        }
+        _spilled = true;
+    }
+
+    protected:
+
+    bool _enabled;
+    bool _spilled;
+    uint16_t _base;
+    uint16_t _top;
+    uint16_t _bytes;
+    uint16_t _cells[NATIVE_STACK_CELLS > 0 ? NATIVE_STACK_CELLS : 1];
+
+    uint32_t _first(uint32_t addr) {
+        return addr < _base ? _base : addr;
+    }
+
+    void _reload(Memory *mem, uint32_t from) {
+        for(uint32_t addr = _first(from); addr <= _top; addr += 2) {
+            _cells[(_top - addr) >> 1] = mem->get(addr);
+        }
+        _spilled = false;
+    }
+};
+#endif
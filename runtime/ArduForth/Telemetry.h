@@ -0,0 +1,37 @@
+#ifndef UKMAKER_TELEMETRY_H
+#define UKMAKER_TELEMETRY_H
+
+#include "FArduino.h"
+
+/**
+ * Binary telemetry records, built by <FRAME F, FD, and sent by FRAME>
+ *
+ *   sync  length  type  (tag value)*  crc
+ *
+ * length counts the bytes from type to the last value. Each value is a
+ * tag byte followed by the value little endian, 2 bytes for a cell and 4
+ * for a double. The crc is CRC-16/CCITT-FALSE of length to the last value,
+ * little endian.
+ *
+ * A record is built in VM RAM: a cell holding the bytes used so far, 0 if
+ * no record is open, then FRAME_MAX bytes for the record itself.
+ */
+
+#define FRAME_SYNC 0xa5
+#define FRAME_TAG_CELL 1
+#define FRAME_TAG_DOUBLE 2
+#define FRAME_HEADER 3 // sync, length and type
+#define FRAME_CRC 2
+#define FRAME_MAX 48   // #FRAME_LEN in core.fasm
+
+// CRC-16/CCITT-FALSE, bitwise as a table costs 512 bytes on a device
+static uint16_t frame_crc(const uint8_t *p, size_t len, uint16_t crc = 0xffff) {
+    while(len-- > 0) {
+        crc ^= (uint16_t)(*p++) << 8;
+        for(uint8_t i=0; i<8; i++) {
+            crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+#endif
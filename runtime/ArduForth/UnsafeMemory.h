@@ -2,6 +2,17 @@
 #define UKMAKER_UNSAFE_MEMORY_H
 
 #include "Memory.h"
+#include "ForthConfiguration.h"
+
+/**
+ * With ROM_CACHE_WORDS set, word reads from ROM go through a small direct
+ * mapped cache in RAM so that the inner interpreter does not pay for a
+ * pgm_read_word on every fetch. Byte reads are not cached; they mostly come
+ * from dictionary searches which would only evict the threads.
+ */
+
+// No ROM word is fetched from an odd address
+#define ROM_CACHE_EMPTY 0xffff
 
 class UnsafeMemory : public Memory {
 
@@ -9,7 +20,11 @@ public:
 
     UnsafeMemory(uint8_t *ram, size_t ramSize, uint16_t ramStart,
         const uint8_t *rom, size_t romSize, uint16_t romStart) : 
-        Memory(ram, ramSize, ramStart, rom, romSize, romStart) {}
+        Memory(ram, ramSize, ramStart, rom, romSize, romStart) {
+            #if ROM_CACHE_WORDS > 0
+            clearRomCache();
+            #endif
+        }
 
     ~UnsafeMemory() {}
 
@@ -17,6 +32,9 @@ public:
         if(addr >= _ramStart && addr <= _ramEnd) {
             *(uint16_t *)(_ram + addr - _ramStart) = w;
         } else {
+            #if ROM_CACHE_WORDS > 0
+            _romTag[_romLine(addr)] = ROM_CACHE_EMPTY;
+            #endif
             *(uint16_t *)(_rom + addr - _romStart) = w;
         }
     }
@@ -26,10 +44,17 @@ public:
         if(addr >= _ramStart && addr <= _ramEnd) {
             return *(uint16_t *)(_ram + addr - _ramStart);
         } else {
-            #ifdef ARDUINO
-            return pgm_read_word(_rom + addr - _romStart);
+            #if ROM_CACHE_WORDS > 0
+            uint16_t line = _romLine(addr);
+            if(_romTag[line] == addr) {
+                _romHits++;
+                return _romData[line];
+            }
+            _romMisses++;
+            _romTag[line] = addr;
+            return _romData[line] = _romWord(addr);
             #else
-            return *(uint16_t *)(_rom + addr - _romStart);
+            return _romWord(addr);
             #endif
         }
     }
@@ -38,6 +63,10 @@ public:
          if(addr >= _ramStart && addr <= (_ramEnd+1)) {
             *(_ram + addr - _ramStart) = c;
          } else {
+            #if ROM_CACHE_WORDS > 0
+            _romTag[_romLine(addr & 0xfffe)] = ROM_CACHE_EMPTY;
+            _romTag[_romLine((addr - 1) & 0xfffe)] = ROM_CACHE_EMPTY;
+            #endif
             *(uint8_t *)(_rom + addr - _romStart) = c;
          }
     }
@@ -70,5 +99,44 @@ public:
             return (uint16_t *)(_rom + addr - _romStart);
          }
      }
+
+    #if ROM_CACHE_WORDS > 0
+    void clearRomCache() {
+        for(uint16_t i=0; i<ROM_CACHE_WORDS; i++) {
+            _romTag[i] = ROM_CACHE_EMPTY;
+        }
+        _romHits = 0;
+        _romMisses = 0;
+    }
+
+    uint32_t romCacheHits() {
+        return _romHits;
+    }
+
+    uint32_t romCacheMisses() {
+        return _romMisses;
+    }
+    #endif
+
+    protected:
+
+    #if ROM_CACHE_WORDS > 0
+    uint16_t _romTag[ROM_CACHE_WORDS];
+    uint16_t _romData[ROM_CACHE_WORDS];
+    uint32_t _romHits;
+    uint32_t _romMisses;
+
+    uint16_t _romLine(uint16_t addr) {
+        return (addr >> 1) & (ROM_CACHE_WORDS - 1);
+    }
+    #endif
+
+    uint16_t _romWord(uint16_t addr) {
+        #ifdef ARDUINO
+        return pgm_read_word(_rom + addr - _romStart);
+        #else
+        return *(uint16_t *)(_rom + addr - _romStart);
+        #endif
+    }
 };
 #endif
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "FArduino.h"
 #include "ForthVM.h"
 #include "FSerial.h"
+#include "LineReader.h"
+#include "Blocks.h"
+#include "Telemetry.h"
 
 #define SYSCALL_DEBUG 0
 #define SYSCALL_TYPE 1
@@ -31,7 +34,88 @@
 #define SYSCALL_FREE_MEMORY 23
 #define SYSCALL_SYSCALL 24
 #define SYSCALL_ARDUINO 25
-#define CORE_SYSCALLS 26
+#define SYSCALL_ROM_CACHE 26
+#define SYSCALL_COMPILE 27
+#define SYSCALL_LITERAL 28
+#define SYSCALL_ISLAND 29
+#define SYSCALL_BLOCK 30
+#define SYSCALL_FORMAT 31
+#define SYSCALL_FRAME 32
+#define SYSCALL_IDLE 33
+#define SYSCALL_THREADED 34
+
+// 0 to CORE_SYSCALLS-1 are the core's, then HOST_SYSCALLS kept on every
+// target for tools/host_syscalls.h so the core words that use them never
+// reach a sketch's syscall, then APP_SYSCALLS from SYSCALL_APP
+#define CORE_SYSCALLS 40
+#define HOST_SYSCALLS 8
+#define APP_SYSCALLS 8
+#define SYSCALL_APP (CORE_SYSCALLS + HOST_SYSCALLS)
+#define SYSCALL_COUNT (SYSCALL_APP + APP_SYSCALLS) // Entries in a syscalls[] table
+
+// Flags of SYSCALL_FORMAT
+#define FORMAT_UNSIGNED 1
+#define FORMAT_DOUBLE 2
+#define FORMAT_CELL 4 // As . does: signed in decimal, else unsigned, hex and binary at full width
+#define FORMAT_MAX 33 // 32 binary digits and a sign
+
+// Operations of SYSCALL_FRAME
+#define FRAME_BEGIN 0
+#define FRAME_CELL 1
+#define FRAME_DOUBLE 2
+#define FRAME_SEND 3
+
+// Operations of SYSCALL_BLOCK
+#define BLOCK_BLOCK 0
+#define BLOCK_BUFFER 1
+#define BLOCK_UPDATE 2
+#define BLOCK_SAVE 3
+#define BLOCK_EMPTY 4
+#define BLOCK_FLUSH 5
+
+// Entries in PEEPHOLE_TABLE in core.fasm
+#define PEEP_DP 0
+#define PEEP_OPTIMIZE 1
+#define PEEP_DEPTH 2
+#define PEEP_HISTORY 3
+#define PEEP_LIT 4
+#define PEEP_PLUS 5
+#define PEEP_MINUS 6
+#define PEEP_TIMES 7
+#define PEEP_AND 8
+#define PEEP_OR 9
+#define PEEP_EQUALS 10
+#define PEEP_ONEPLUS 11
+#define PEEP_ONEMINUS 12
+#define PEEP_TWOPLUS 13
+#define PEEP_TWOMINUS 14
+#define PEEP_ZERO_EQUALS 15
+#define PEEP_SWAP 16
+#define PEEP_DROP 17
+#define PEEP_NIP 18
+#define PEEP_SEMI 19
+#define PEEP_COLON 20
+#define PEEP_TAIL 21
+#define PEEP_RFROM 22
+#define PEEP_CONSTANT 23
+#define PEEP_CURRENT 24
+#define PEEP_INLINE 25
+#define PEEP_REJECT 26
+#define PEEP_STC 27
+#define PEEP_ISLAND 28
+#define PEEP_MODE 29
+#define PEEP_STC_COLON 30
+#define PEEP_STC_ITC 31
+#define PEEP_STC_NATIVE 32
+#define PEEP_NEXT 33
+#define PEEP_NO_ISLAND 34
+#define PEEP_STC_THREADED 35
+
+// Size of %PEEPHOLE_HISTORY in cells
+#define PEEPHOLE_HISTORY 4
+
+// Longest primitive copied into subroutine-threaded code, in bytes
+#define STC_INLINE_BYTES 24
 
 #ifdef ARDUINO
 #ifdef __arm__
@@ -64,6 +148,16 @@ void syscall_free_memory(ForthVM *vm) {
 #endif
 }
 
+// ( -- hits.d misses.d )
+void syscall_rom_cache(ForthVM *vm) {
+    uint32_t h = vm->ram()->romCacheHits();
+    uint32_t m = vm->ram()->romCacheMisses();
+    vm->push(h & 0x0000ffff);
+    vm->push(h >> 16);
+    vm->push(m & 0x0000ffff);
+    vm->push(m >> 16);
+}
+
 void syscall_unimplemented(ForthVM *vm) {
     uint16_t i = vm->read(vm->get(REG_PC) - 2);
     uint16_t s = i & 0xff;
@@ -78,6 +172,27 @@ void syscall_syscall(ForthVM *vm) {
 }
 
 
+// Write len bytes of VM memory from addr to the serial port
+static void _serial_write(ForthVM *vm, uint16_t addr, uint16_t len) {
+    if(vm->ram()->inRam(addr, len)) {
+        // One write straight from VM RAM
+        Serial.write(vm->ram()->addressOfChar(addr), len);
+        return;
+    }
+    // ROM, or a string crossing into it, goes through a buffer
+    uint8_t buf[TYPE_CHUNK];
+    while(len > 0) {
+        uint16_t n = len < TYPE_CHUNK ? len : TYPE_CHUNK;
+        for (uint16_t i = 0; i < n; i++)
+        {
+            buf[i] = vm->readByte(addr + i);
+        }
+        Serial.write(buf, n);
+        addr += n;
+        len -= n;
+    }
+}
+
 void syscall_type(ForthVM *vm)
 {
     // Syscall to print the string pointed to by the top of stack
@@ -85,25 +200,19 @@ void syscall_type(ForthVM *vm)
     // ( addr - )
     uint16_t dp = vm->pop();
     uint16_t len = vm->read(dp); // length in bytes
-    dp += 2;
-    uint8_t b;
-    for (uint16_t i = 0; i < len; i++)
-    {
-        b = vm->readByte(dp + i);
-        #ifdef ARDUINO
-        Serial.print((char)b);
-        #else
-        Serial.printf("%c", b);
-        #endif
-    }
+    _serial_write(vm, dp + 2, len);
+    #if TYPE_FLUSH == TYPE_FLUSH_ALWAYS
     Serial.flush();
+    #endif
 }
 
 void syscall_typeln(ForthVM *vm)
 {
     syscall_type(vm);
     Serial.print('\n');
+    #if TYPE_FLUSH != TYPE_FLUSH_NEVER
     Serial.flush();
+    #endif
 }
 
 void syscall_dot(ForthVM *vm)
@@ -148,6 +257,124 @@ void syscall_dot(ForthVM *vm)
     }
 }
 
+void syscall_format(ForthVM *vm)
+{
+    // Format a number in any base from 2 to 36 as a string at buf for TYPE
+    // ( x base flags buf -- buf ) or ( d base flags buf -- buf ) for FORMAT_DOUBLE
+    static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    uint16_t buf = vm->pop();
+    uint16_t flags = vm->pop();
+    uint16_t base = vm->pop();
+    uint8_t bits = 16;
+    uint32_t v = vm->pop();
+    if(flags & FORMAT_DOUBLE) {
+        v = (v << 16) | vm->pop();
+        bits = 32;
+    }
+    if(base < 2 || base > 36) {
+        base = 10;
+    }
+    uint8_t width = 0;
+    if(flags & FORMAT_CELL) {
+        if(base == 10) {
+            flags &= ~FORMAT_UNSIGNED;
+        } else {
+            flags |= FORMAT_UNSIGNED;
+            if(base == 16) {
+                width = bits / 4;
+            } else if(base == 2) {
+                width = bits;
+            }
+        }
+    }
+    bool negative = !(flags & FORMAT_UNSIGNED) && (v >> (bits - 1)) != 0;
+    if(negative) {
+        v = (bits == 32 ? 0 : 0x10000) - v;
+    }
+
+    char out[FORMAT_MAX];
+    uint8_t i = FORMAT_MAX;
+    do {
+        out[--i] = digits[v % base];
+        v /= base;
+    } while(v > 0 || FORMAT_MAX - i < width);
+    if(negative) {
+        out[--i] = '-';
+    }
+    uint16_t len = FORMAT_MAX - i;
+    vm->ram()->put(buf, len);
+    for(uint16_t j = 0; j < len; j++) {
+        vm->ram()->putC(buf + 2 + j, out[i + j]);
+    }
+    vm->push(buf);
+}
+
+void syscall_frame(ForthVM *vm)
+{
+    // Build and send a telemetry record, see Telemetry.h
+    // ( ... frame op -- ... ) frame is the record's fill count and bytes
+    uint16_t op = vm->pop();
+    uint16_t frame = vm->pop();
+    uint16_t fill = vm->read(frame);
+    uint16_t data = frame + 2;
+    Memory *mem = vm->ram();
+    switch(op) {
+        case FRAME_BEGIN: // ( type -- )
+            mem->putC(data, FRAME_SYNC);
+            mem->putC(data + 2, vm->pop());
+            fill = FRAME_HEADER;
+            break;
+        case FRAME_CELL:   // ( n -- )
+        case FRAME_DOUBLE: { // ( d -- )
+            uint32_t v = vm->pop();
+            uint8_t size = 2;
+            if(op == FRAME_DOUBLE) {
+                v = (v << 16) | vm->pop();
+                size = 4;
+            }
+            if(fill == 0) {
+                break; // No record open
+            }
+            if(fill + 1 + size + FRAME_CRC > FRAME_MAX) {
+                fill = 0; // Too long, the record is dropped
+                break;
+            }
+            mem->putC(data + fill++, op == FRAME_DOUBLE ? FRAME_TAG_DOUBLE : FRAME_TAG_CELL);
+            for(uint8_t i=0; i<size; i++) {
+                mem->putC(data + fill++, v & 0xff);
+                v >>= 8;
+            }
+            break;
+        }
+        case FRAME_SEND: { // ( -- )
+            if(fill == 0 || fill > FRAME_MAX - FRAME_CRC) {
+                fill = 0; // None open, or %FRAME_FILL was overwritten
+                break;
+            }
+            mem->putC(data + 1, fill - 2);
+            uint16_t crc = 0xffff;
+            if(mem->inRam(data + 1, fill - 1)) {
+                crc = frame_crc(mem->addressOfChar(data + 1), fill - 1);
+            } else {
+                for(uint16_t i=1; i<fill; i++) {
+                    uint8_t b = mem->getC(data + i);
+                    crc = frame_crc(&b, 1, crc);
+                }
+            }
+            mem->putC(data + fill++, crc & 0xff);
+            mem->putC(data + fill++, crc >> 8);
+            _serial_write(vm, data, fill);
+            #if TYPE_FLUSH == TYPE_FLUSH_ALWAYS
+            Serial.flush();
+            #endif
+            fill = 0;
+            break;
+        }
+        default: break;
+    }
+    mem->put(frame, fill);
+}
+
 void syscall_dot_c(ForthVM *vm)
 {
     // Syscall to print the low byte of a value on the stack
@@ -191,9 +418,12 @@ void syscall_dot_c(ForthVM *vm)
     }
 }
 
+// Console input, fed by poll() in INLINE or by the sketch calling receive()
+LineReader console;
+
 void syscall_getc(ForthVM *vm)
 {
-    int c = Serial.read();
+    int c = console.read();
     vm->push(c);
 }
 
@@ -202,6 +432,12 @@ void syscall_putc(ForthVM *vm)
     Serial.print((char)vm->pop());
 }
 
+void syscall_idle(ForthVM *vm)
+{
+    // ( ms -- ) Sleep until there is console input or ms have passed
+    console.wait(vm->pop());
+}
+
 void syscall_inline(ForthVM *vm)
 {
     // address of the buffer struct
@@ -210,28 +446,59 @@ void syscall_inline(ForthVM *vm)
     uint16_t bufend = buf + 2;
     uint16_t bufstart = buf + 4;
 
-    uint8_t *cbuf = vm->ram()->addressOfChar(bufstart);
-    size_t read;
-    if(!Serial.available())
+    // Return at once, the outer loop asks again until a line is complete
+    console.poll();
+    int16_t read = console.line(vm->ram(), bufstart, INLINE_MAX);
+    if(read < 0)
     {
         vm->push(0x00); // No input
     }
-    else 
+    else if(read > 0)
     {
-        read = Serial.readBytesUntil(0x0a, (char *)cbuf, 63);
-        if(read > 0)
-        {
-            vm->ram()->put(bufend, bufstart + read);
-            // Current buffer pointer is just the start of the buffer
-            vm->ram()->put(bufidx, bufstart);
-            vm->push(0x01);
-            //Serial.print("BYTES READ = "); Serial.println(read);
-            //Serial.print("FIRST>"); Serial.println(vm->ram()->getC(bufstart));
-        }
-        else
-        {
-            vm->push(0x02); // Empty input
+        vm->ram()->put(bufend, bufstart + read);
+        // Current buffer pointer is just the start of the buffer
+        vm->ram()->put(bufidx, bufstart);
+        vm->push(0x01);
+    }
+    else
+    {
+        vm->push(0x02); // Empty input
+    }
+}
+
+// The sketch or host sets this to give BLOCK its storage
+Blocks *forthBlocks = NULL;
+
+void syscall_block(ForthVM *vm) {
+    uint16_t op = vm->pop();
+    if(forthBlocks == NULL) {
+        if(op == BLOCK_BLOCK || op == BLOCK_BUFFER) {
+            vm->pop();
+            vm->push(0);
         }
+        return;
+    }
+    switch(op) {
+        case BLOCK_BLOCK: // ( n -- addr )
+            vm->push(forthBlocks->block(vm->ram(), vm->pop(), true));
+            break;
+        case BLOCK_BUFFER: // ( n -- addr )
+            vm->push(forthBlocks->block(vm->ram(), vm->pop(), false));
+            break;
+        case BLOCK_UPDATE:
+            forthBlocks->update();
+            break;
+        case BLOCK_SAVE:
+            forthBlocks->save(vm->ram());
+            break;
+        case BLOCK_EMPTY:
+            forthBlocks->empty();
+            break;
+        case BLOCK_FLUSH:
+            forthBlocks->save(vm->ram());
+            forthBlocks->empty();
+            break;
+        default: break;
     }
 }
 
@@ -620,4 +887,450 @@ void syscall_compare(ForthVM *vm) {
     vm->push(r);
 }
 
+/**
+ * The peephole optimizer behind COMPILE, and LITERAL
+ *
+ * The addresses of each instruction compiled into the current definition
+ * are kept in %PEEPHOLE_HISTORY. An instruction is either a word or *# and
+ * its literal. Anything else written to the dictionary must be preceded by
+ * BARRIER, which empties the history, so the optimizer never rewrites a
+ * cell which might be a branch target or inline data.
+ *
+ * SEMI is still compiled after a tail call to mark the end of the word.
+ */
+uint16_t peep_table(ForthVM *vm, uint16_t table, uint8_t entry) {
+    return vm->read(table + (entry << 1));
+}
+
+uint16_t peep_here(ForthVM *vm, uint16_t table) {
+    return vm->read(peep_table(vm, table, PEEP_DP));
+}
+
+void peep_set_here(ForthVM *vm, uint16_t table, uint16_t here) {
+    vm->ram()->put(peep_table(vm, table, PEEP_DP), here);
+}
+
+uint16_t peep_size(ForthVM *vm, uint16_t table, uint16_t addr) {
+    return vm->read(addr) == peep_table(vm, table, PEEP_LIT) ? 4 : 2;
+}
+
+// Address of the instruction back places before HERE, 0 if unknown
+uint16_t peep_back(ForthVM *vm, uint16_t table, uint8_t back) {
+    uint16_t depth = vm->read(peep_table(vm, table, PEEP_DEPTH));
+    uint16_t history = peep_table(vm, table, PEEP_HISTORY);
+    uint16_t end = peep_here(vm, table);
+    if(depth > PEEPHOLE_HISTORY) {
+        return 0;
+    }
+    for(uint8_t i = 0; i <= back; i++) {
+        if(i == depth) {
+            return 0;
+        }
+        uint16_t addr = vm->read(history + ((depth - 1 - i) << 1));
+        if(addr + peep_size(vm, table, addr) != end) {
+            return 0;
+        }
+        end = addr;
+    }
+    return end;
+}
+
+void peep_record(ForthVM *vm, uint16_t table, uint16_t addr) {
+    uint16_t depthVar = peep_table(vm, table, PEEP_DEPTH);
+    uint16_t history = peep_table(vm, table, PEEP_HISTORY);
+    uint16_t depth = vm->read(depthVar);
+    if(depth >= PEEPHOLE_HISTORY) {
+        for(uint8_t i = 1; i < PEEPHOLE_HISTORY; i++) {
+            vm->ram()->put(history + ((i - 1) << 1), vm->read(history + (i << 1)));
+        }
+        depth = PEEPHOLE_HISTORY - 1;
+    }
+    vm->ram()->put(history + (depth << 1), addr);
+    vm->ram()->put(depthVar, depth + 1);
+}
+
+void peep_forget(ForthVM *vm, uint16_t table) {
+    uint16_t depthVar = peep_table(vm, table, PEEP_DEPTH);
+    uint16_t depth = vm->read(depthVar);
+    if(depth > 0) {
+        vm->ram()->put(depthVar, depth - 1);
+    }
+}
+
+// Fold ( a b -- a op b ) for the operators with no side effects
+bool peep_fold(ForthVM *vm, uint16_t table, uint16_t wa, uint16_t a, uint16_t b, uint16_t *r) {
+    if(wa == peep_table(vm, table, PEEP_PLUS)) *r = a + b;
+    else if(wa == peep_table(vm, table, PEEP_MINUS)) *r = a - b;
+    else if(wa == peep_table(vm, table, PEEP_TIMES)) *r = a * b;
+    else if(wa == peep_table(vm, table, PEEP_AND)) *r = a & b;
+    else if(wa == peep_table(vm, table, PEEP_OR)) *r = a | b;
+    else if(wa == peep_table(vm, table, PEEP_EQUALS)) *r = (a == b) ? 1 : 0;
+    else return false;
+    return true;
+}
+
+// The primitive which does the same as *# n wa, 0 if there is none
+uint16_t peep_shortcut(ForthVM *vm, uint16_t table, uint16_t wa, uint16_t n) {
+    uint16_t plus = peep_table(vm, table, PEEP_PLUS);
+    uint16_t minus = peep_table(vm, table, PEEP_MINUS);
+    if(n == 1 && wa == plus) return peep_table(vm, table, PEEP_ONEPLUS);
+    if(n == 1 && wa == minus) return peep_table(vm, table, PEEP_ONEMINUS);
+    if(n == 2 && wa == plus) return peep_table(vm, table, PEEP_TWOPLUS);
+    if(n == 2 && wa == minus) return peep_table(vm, table, PEEP_TWOMINUS);
+    if(n == 0 && wa == peep_table(vm, table, PEEP_EQUALS)) return peep_table(vm, table, PEEP_ZERO_EQUALS);
+    return 0;
+}
+
+/**
+ * Turn a call to a colon word just before SEMI into *TAIL and the address
+ * of its body. Words starting with R> are left alone as they expect to
+ * find their caller's frame on the return stack.
+ */
+void peep_tail(ForthVM *vm, uint16_t table) {
+    uint16_t last = peep_back(vm, table, 0);
+    if(last == 0) {
+        return;
+    }
+    uint16_t callee = vm->read(last);
+    if(callee == peep_table(vm, table, PEEP_LIT)
+        || vm->read(callee) != peep_table(vm, table, PEEP_COLON)
+        || vm->read(callee + 2) == peep_table(vm, table, PEEP_RFROM)) {
+        return;
+    }
+    vm->ram()->put(last, peep_table(vm, table, PEEP_TAIL));
+    vm->ram()->put(last + 2, callee + 2);
+    peep_set_here(vm, table, last + 4);
+    vm->ram()->put(peep_table(vm, table, PEEP_DEPTH), 0);
+}
+
+bool peep_optimize(ForthVM *vm, uint16_t table, uint16_t wa) {
+    uint16_t lit = peep_table(vm, table, PEEP_LIT);
+    if(wa == peep_table(vm, table, PEEP_SEMI)) {
+        peep_tail(vm, table);
+        return false;
+    }
+    uint16_t last = peep_back(vm, table, 0);
+    if(last == 0) {
+        return false;
+    }
+    if(vm->read(last) == lit) {
+        uint16_t n = vm->read(last + 2);
+        uint16_t prev = peep_back(vm, table, 1);
+        uint16_t r;
+        if(prev != 0 && vm->read(prev) == lit
+            && peep_fold(vm, table, wa, vm->read(prev + 2), n, &r)) {
+            // *# a *# b op -> *# r
+            vm->ram()->put(prev + 2, r);
+            peep_set_here(vm, table, prev + 4);
+            peep_forget(vm, table);
+            return true;
+        }
+        uint16_t shortcut = peep_shortcut(vm, table, wa, n);
+        if(shortcut != 0) {
+            // *# 1 + -> 1+ and so on
+            vm->ram()->put(last, shortcut);
+            peep_set_here(vm, table, last + 2);
+            return true;
+        }
+    } else if(vm->read(last) == peep_table(vm, table, PEEP_SWAP)
+        && wa == peep_table(vm, table, PEEP_DROP)) {
+        vm->ram()->put(last, peep_table(vm, table, PEEP_NIP));
+        return true;
+    }
+    return false;
+}
+
+bool stc_on(ForthVM *vm, uint16_t table);
+void stc_literal(ForthVM *vm, uint16_t table, uint16_t n);
+
+void peep_literal(ForthVM *vm, uint16_t table, uint16_t n) {
+    if(stc_on(vm, table)) {
+        stc_literal(vm, table, n);
+        return;
+    }
+    uint16_t here = peep_here(vm, table);
+    vm->ram()->put(here, peep_table(vm, table, PEEP_LIT));
+    vm->ram()->put(here + 2, n);
+    peep_set_here(vm, table, here + 4);
+    peep_record(vm, table, here);
+}
+
+bool peep_inline(ForthVM *vm, uint16_t table, uint16_t wa);
+void stc_compile(ForthVM *vm, uint16_t table, uint16_t wa);
+void stc_literal(ForthVM *vm, uint16_t table, uint16_t n);
+
+void peep_compile(ForthVM *vm, uint16_t table, uint16_t wa) {
+    if(stc_on(vm, table)) {
+        stc_compile(vm, table, wa);
+        return;
+    }
+    if(vm->read(peep_table(vm, table, PEEP_OPTIMIZE)) != 0
+        && (peep_inline(vm, table, wa) || peep_optimize(vm, table, wa))) {
+        return;
+    }
+    uint16_t here = peep_here(vm, table);
+    vm->ram()->put(here, wa);
+    peep_set_here(vm, table, here + 2);
+    peep_record(vm, table, here);
+}
+
+bool peep_rejected(ForthVM *vm, uint16_t table, uint16_t wa) {
+    // Colon words starting with R> work on their caller's frame
+    if(vm->read(wa) == peep_table(vm, table, PEEP_COLON)
+        && vm->read(wa + 2) == peep_table(vm, table, PEEP_RFROM)) {
+        return true;
+    }
+    for(uint16_t r = peep_table(vm, table, PEEP_REJECT); vm->read(r) != 0; r += 2) {
+        if(vm->read(r) == wa) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Compile the body of a short colon word in place of a call to it, or the
+ * value of a CONSTANT as a literal. Each copied instruction goes through
+ * the optimizer again so that, say, a constant body can fold into the
+ * arithmetic around it.
+ */
+bool peep_inline(ForthVM *vm, uint16_t table, uint16_t wa) {
+    uint16_t cells = vm->read(peep_table(vm, table, PEEP_INLINE));
+    uint16_t lit = peep_table(vm, table, PEEP_LIT);
+    uint16_t semi = peep_table(vm, table, PEEP_SEMI);
+    if(cells == 0) {
+        return false;
+    }
+    if(vm->read(wa) == peep_table(vm, table, PEEP_CONSTANT)) {
+        peep_literal(vm, table, vm->read(wa + 2));
+        return true;
+    }
+    if(vm->read(wa) != peep_table(vm, table, PEEP_COLON)) {
+        return false;
+    }
+    // Never the word being defined, its body is not finished
+    uint16_t latest = vm->read(vm->read(peep_table(vm, table, PEEP_CURRENT)));
+    if(wa > latest) {
+        return false;
+    }
+    uint16_t body = wa + 2;
+    uint16_t end = body;
+    while(vm->read(end) != semi) {
+        if(end - body >= (cells << 1)) {
+            return false;
+        }
+        uint16_t c = vm->read(end);
+        if(c == lit) {
+            end += 4;
+        } else if(peep_rejected(vm, table, c)) {
+            return false;
+        } else {
+            end += 2;
+        }
+    }
+    if(end - body > (cells << 1)) {
+        return false;
+    }
+    while(body < end) {
+        if(vm->read(body) == lit) {
+            peep_literal(vm, table, vm->read(body + 2));
+            body += 4;
+        } else {
+            peep_compile(vm, table, vm->read(body));
+            body += 2;
+        }
+    }
+    return true;
+}
+
+/**
+ * Subroutine threading
+ *
+ * With STC set, : gives the new word STC_COLON as its code address and
+ * compiles its body as native code which ends in RET:
+ *
+ *   - another STC word is compiled as CALL to its body
+ *   - a primitive which runs straight through to JP NEXT, without touching
+ *     I, WA, CA, PC or the return stack, is copied in place
+ *   - a literal is compiled as MOVIL A,n PUSHD A
+ *
+ * Anything else, and everything an immediate word compiles, goes into an
+ * island of threaded code opened with CALL STC_ITC and closed by the cell
+ * STC_NATIVE. %STC_ISLAND holds the start of the open island; an address
+ * before the latest header belongs to an earlier definition and means
+ * native code.
+ *
+ * Words which take their caller's frame from the return stack, DOES> and
+ * SCODE, can not be used in an STC definition. ?EXECUTE asks THREADED?
+ * before compiling a word and drops the definition if it is one of them.
+ */
+bool stc_on(ForthVM *vm, uint16_t table) {
+    return vm->read(peep_table(vm, table, PEEP_STC)) != 0;
+}
+
+void stc_emit(ForthVM *vm, uint16_t table, uint16_t w) {
+    uint16_t here = peep_here(vm, table);
+    vm->ram()->put(here, w);
+    peep_set_here(vm, table, here + 2);
+}
+
+bool stc_in_island(ForthVM *vm, uint16_t table) {
+    uint16_t island = vm->read(peep_table(vm, table, PEEP_ISLAND));
+    uint16_t latest = vm->read(vm->read(peep_table(vm, table, PEEP_CURRENT)));
+    return island != 0 && island > latest;
+}
+
+void stc_island(ForthVM *vm, uint16_t table) {
+    if(stc_in_island(vm, table)) {
+        return;
+    }
+    stc_emit(vm, table, OP_CALL << OP_BITS);
+    stc_emit(vm, table, peep_table(vm, table, PEEP_STC_ITC));
+    vm->ram()->put(peep_table(vm, table, PEEP_ISLAND), peep_here(vm, table));
+    vm->ram()->put(peep_table(vm, table, PEEP_DEPTH), 0);
+}
+
+void stc_native(ForthVM *vm, uint16_t table) {
+    if(!stc_in_island(vm, table)) {
+        return;
+    }
+    stc_emit(vm, table, peep_table(vm, table, PEEP_STC_NATIVE));
+    vm->ram()->put(peep_table(vm, table, PEEP_ISLAND), 0);
+}
+
+// Bytes of code before JP NEXT if the primitive at ca can be copied, else 0
+uint16_t stc_inline_length(ForthVM *vm, uint16_t table, uint16_t ca) {
+    uint16_t next = peep_table(vm, table, PEEP_NEXT);
+    for(uint16_t pc = ca; pc - ca <= STC_INLINE_BYTES; ) {
+        uint16_t instr = vm->read(pc);
+        if(instr & JP_OR_CALL_MASK) {
+            return (instr == (OP_JP << OP_BITS) && vm->read(pc + 2) == next) ? pc - ca : 0;
+        }
+        uint8_t op = (instr & OP_MASK) >> OP_BITS;
+        uint8_t a = (instr & ARGA_MASK) >> ARGA_BITS;
+        uint8_t b = (instr & ARGB_MASK) >> ARGB_BITS;
+        switch(op) {
+            case OP_MOVAI: case OP_MOVBI: case OP_STAI: case OP_STBI:
+            case OP_STAI_B: case OP_STBI_B: case OP_ADDAI: case OP_ADDBI:
+            case OP_SUBAI: case OP_SUBBI: case OP_CMPAI: case OP_CMPBI:
+            case OP_SYSCALL:
+                // the low byte is a number
+                pc += 2;
+                continue;
+            case OP_PUSHR: case OP_POPR: case OP_RET: case OP_HALT: case OP_BRK:
+                return 0;
+        }
+        if(a >= REG_I || (b >= REG_I && b != REG_SP)) {
+            return 0;
+        }
+        switch(op) {
+            case OP_MOVIL: case OP_STIL: case OP_ADDIL: case OP_SUBIL: case OP_CMPIL:
+                pc += 4;
+                break;
+            default:
+                pc += 2;
+        }
+    }
+    return 0;
+}
+
+void stc_literal(ForthVM *vm, uint16_t table, uint16_t n) {
+    stc_native(vm, table);
+    stc_emit(vm, table, (OP_MOVIL << OP_BITS) | (REG_A << ARGA_BITS));
+    stc_emit(vm, table, n);
+    stc_emit(vm, table, (OP_PUSHD << OP_BITS) | (REG_A << ARGA_BITS));
+    vm->ram()->put(peep_table(vm, table, PEEP_DEPTH), 0);
+}
+
+void stc_compile(ForthVM *vm, uint16_t table, uint16_t wa) {
+    uint16_t ca = vm->read(wa);
+    uint16_t depthVar = peep_table(vm, table, PEEP_DEPTH);
+    if(wa == peep_table(vm, table, PEEP_SEMI)) {
+        stc_native(vm, table);
+        uint16_t last = vm->read(peep_table(vm, table, PEEP_HISTORY));
+        if(vm->read(depthVar) == 1 && last + 4 == peep_here(vm, table)
+            && vm->read(last) == (OP_CALL << OP_BITS)) {
+            // CALL x RET -> JP x
+            vm->ram()->put(last, OP_JP << OP_BITS);
+        } else {
+            stc_emit(vm, table, OP_RET << OP_BITS);
+        }
+        vm->ram()->put(depthVar, 0);
+        return;
+    }
+    if(ca == peep_table(vm, table, PEEP_STC_COLON)) {
+        stc_native(vm, table);
+        uint16_t here = peep_here(vm, table);
+        stc_emit(vm, table, OP_CALL << OP_BITS);
+        stc_emit(vm, table, wa + 2);
+        // Only the last CALL is remembered, for the tail call at ;
+        vm->ram()->put(peep_table(vm, table, PEEP_HISTORY), here);
+        vm->ram()->put(depthVar, 1);
+        return;
+    }
+    if(ca == peep_table(vm, table, PEEP_CONSTANT)
+        && vm->read(peep_table(vm, table, PEEP_INLINE)) != 0) {
+        stc_literal(vm, table, vm->read(wa + 2));
+        return;
+    }
+    uint16_t length = ca == wa + 2 ? stc_inline_length(vm, table, ca) : 0;
+    if(length != 0) {
+        stc_native(vm, table);
+        for(uint16_t i = 0; i < length; i += 2) {
+            stc_emit(vm, table, vm->read(ca + i));
+        }
+        vm->ram()->put(depthVar, 0);
+        return;
+    }
+    stc_island(vm, table);
+    stc_emit(vm, table, wa);
+}
+
+// ( wa table -- )
+void syscall_compile(ForthVM *vm) {
+    uint16_t table = vm->pop();
+    uint16_t wa = vm->pop();
+    peep_compile(vm, table, wa);
+}
+
+// ( n table -- )
+void syscall_literal(ForthVM *vm) {
+    uint16_t table = vm->pop();
+    uint16_t n = vm->pop();
+    peep_literal(vm, table, n);
+}
+
+// ( na table -- ) Open an island for an immediate word to compile into
+void syscall_island(ForthVM *vm) {
+    uint16_t table = vm->pop();
+    uint16_t na = vm->pop();
+    if(!stc_on(vm, table) || vm->read(peep_table(vm, table, PEEP_MODE)) == 0) {
+        return;
+    }
+    for(uint16_t r = peep_table(vm, table, PEEP_NO_ISLAND); vm->read(r) != 0; r += 2) {
+        if(vm->read(r) == na) {
+            return;
+        }
+    }
+    stc_island(vm, table);
+}
+
+// ( na table -- f ) True if STC is on and na is in the table's list of
+// words which need a threaded caller. The definition will be dropped, so
+// any island it opened is closed too
+void syscall_threaded(ForthVM *vm) {
+    uint16_t table = vm->pop();
+    uint16_t na = vm->pop();
+    if(stc_on(vm, table)) {
+        for(uint16_t r = peep_table(vm, table, PEEP_STC_THREADED); vm->read(r) != 0; r += 2) {
+            if(vm->read(r) == na) {
+                vm->ram()->put(peep_table(vm, table, PEEP_ISLAND), 0);
+                vm->push(1);
+                return;
+            }
+        }
+    }
+    vm->push(0);
+}
+
 #endif
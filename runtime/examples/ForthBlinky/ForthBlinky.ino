@@ -16,11 +16,11 @@
 
 uint8_t ram[16384];
 
-UnsafeMemory mem(ram, 16384, 0x2000, rom, 8192, 0);
+UnsafeMemory mem(ram, 16384, 0x2000, rom, sizeof(rom), 0);
 
-Syscall syscalls[40];
+Syscall syscalls[SYSCALL_COUNT];
 
-ForthVM vm(&mem, syscalls, 40);
+ForthVM vm(&mem, syscalls, SYSCALL_COUNT);
 
 void syscall_debug(ForthVM *vm)
 {
@@ -33,6 +33,7 @@ void attachSyscalls()
   vm.addSyscall(SYSCALL_TYPE, syscall_type);
   vm.addSyscall(SYSCALL_TYPELN, syscall_typeln);
   vm.addSyscall(SYSCALL_DOT, syscall_dot);
+  vm.addSyscall(SYSCALL_FORMAT, syscall_format);
   vm.addSyscall(SYSCALL_GETC, syscall_getc);
   vm.addSyscall(SYSCALL_PUTC, syscall_putc);
   vm.addSyscall(SYSCALL_INLINE, syscall_inline);
@@ -52,8 +53,16 @@ void attachSyscalls()
 
   vm.addSyscall(SYSCALL_DOTC, syscall_dot_c);
   vm.addSyscall(SYSCALL_FREE_MEMORY, syscall_free_memory);
+  vm.addSyscall(SYSCALL_ROM_CACHE, syscall_rom_cache);
+  vm.addSyscall(SYSCALL_COMPILE, syscall_compile);
+  vm.addSyscall(SYSCALL_LITERAL, syscall_literal);
+  vm.addSyscall(SYSCALL_ISLAND, syscall_island);
+  vm.addSyscall(SYSCALL_THREADED, syscall_threaded);
   vm.addSyscall(SYSCALL_SYSCALL, syscall_syscall);
   vm.addSyscall(SYSCALL_ARDUINO, syscall_arduino);
+  vm.addSyscall(SYSCALL_BLOCK, syscall_block);
+  vm.addSyscall(SYSCALL_FRAME, syscall_frame);
+  vm.addSyscall(SYSCALL_IDLE, syscall_idle);
   }
 
 
@@ -62,6 +71,8 @@ void setup()
     pinMode(PC13, OUTPUT);
     digitalWrite(PC13, 1);
     attachSyscalls();
+    vm.setStackBounds(FORTH_VAREND, FORTH_SPTOP, FORTH_SPTOP + 2, FORTH_RSTOP);
+    vm.setStackTrap(FORTH_STACK_TRAP);
     Serial.begin(115200);
     vm.reset();
 }
@@ -0,0 +1,93 @@
+#ifndef UKMAKER_BLOCKTESTS_H
+#define UKMAKER_BLOCKTESTS_H
+
+#include <stdlib.h>
+#include "Test.h"
+#include "../runtime/ArduForth/syscalls.h"
+#include "../tools/BlockFile.h"
+
+// Counts the blocks written back to a BlockFile
+class CountingStorage : public BlockStorage {
+
+    public:
+
+    CountingStorage(BlockStorage *storage) : _storage(storage), writes(0) {}
+
+    uint16_t blocks() {
+        return _storage->blocks();
+    }
+
+    bool read(uint16_t block, uint16_t offset, uint8_t *buf, uint16_t len) {
+        return _storage->read(block, offset, buf, len);
+    }
+
+    bool write(uint16_t block, uint16_t offset, const uint8_t *buf, uint16_t len) {
+        writes++;
+        return _storage->write(block, offset, buf, len);
+    }
+
+    BlockStorage *_storage;
+    int writes;
+};
+
+class BlockTests : public Test {
+
+    public:
+    BlockTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader),
+        counter(&file), blocks(&counter, 0x3000) {}
+
+    Assembler basm;
+    BlockFile file;
+    CountingStorage counter;
+    Blocks blocks;
+
+    void run() {
+        if(!shouldAssembleBlocks()) {
+            return;
+        }
+        char path[] = "/tmp/forth-blocks-XXXXXX";
+        int fd = mkstemp(path);
+        assert(fd >= 0, "Should create a block file", path);
+        if(fd < 0) {
+            return;
+        }
+        close(fd);
+        file.open(path, 8);
+        forthBlocks = &blocks;
+        vm->addSyscall(SYSCALL_BLOCK, syscall_block);
+        shouldReadBackAnUpdatedBlock();
+        shouldKeepTheBlockInTheFile();
+        shouldRejectMissingBlocks();
+        forthBlocks = NULL;
+        file.close();
+        unlink(path);
+    }
+
+    bool shouldAssembleBlocks() {
+        printf("         shouldAssembleBlocks\n");
+        return assembleInto(basm, "tests/test-blocks.fasm");
+    }
+
+    void shouldReadBackAnUpdatedBlock() {
+        printf("         shouldReadBackAnUpdatedBlock\n");
+        vm->reset();
+        vm->set(REG_PC, basm.getLabelAddress("START"));
+        vm->run();
+        assertEquals(vm->get(REG_B), 0x1234, "Block 3 after FLUSH");
+        assertEquals(counter.writes, 1, "Only the updated block is written");
+    }
+
+    void shouldKeepTheBlockInTheFile() {
+        printf("         shouldKeepTheBlockInTheFile\n");
+        uint8_t data[2];
+        file.read(3, 0, data, 2);
+        assertEquals(data[0] | (data[1] << 8), 0x1234, "Block 3 in the file");
+        assertEquals(file.blocks(), 8, "Blocks in a new file");
+    }
+
+    void shouldRejectMissingBlocks() {
+        printf("         shouldRejectMissingBlocks\n");
+        assertEquals(blocks.block(vm->ram(), 8, true), 0, "Past the last block");
+    }
+};
+#endif
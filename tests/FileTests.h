@@ -0,0 +1,201 @@
+#ifndef UKMAKER_FILETESTS_H
+#define UKMAKER_FILETESTS_H
+
+#include <stdlib.h>
+#include <unistd.h>
+#include "Test.h"
+#include "../tools/host_syscalls.h"
+
+#define FILE_TEST_NAME 0x2a00
+#define FILE_TEST_BUF 0x2b00
+#define FILE_TEST_DATA 0x2c00
+#define FILE_TEST_SP 0x2dfe
+
+/**
+ * The host file syscalls, see host_syscalls.h, called directly on the VM
+ * with their arguments on the stack as the core words leave them
+ */
+class FileTests : public Test {
+
+    public:
+    FileTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    char outer[32];
+    char inner[32];
+
+    void run() {
+        strcpy(outer, "/tmp/forth-outer-XXXXXX");
+        strcpy(inner, "/tmp/forth-inner-XXXXXX");
+        int fo = mkstemp(outer);
+        int fi = mkstemp(inner);
+        assert(fo >= 0 && fi >= 0, "Should create the test files");
+        if(fo < 0 || fi < 0) {
+            return;
+        }
+        close(fo);
+        close(fi);
+        shouldResumeOuterFile();
+        shouldSplitLongLine();
+        shouldReadLastLineWithoutNewline();
+        shouldRoundTripWriteAndSeek();
+        shouldRunOutOfHandles();
+        unlink(outer);
+        unlink(inner);
+    }
+
+    void writeFile(const char *path, const char *text) {
+        FILE *fp = fopen(path, "w");
+        fputs(text, fp);
+        fclose(fp);
+    }
+
+    // ( name mode -- handle )
+    uint16_t openFile(const char *path, uint16_t mode) {
+        uint16_t len = strlen(path);
+        vm->ram()->put(FILE_TEST_NAME, len);
+        for(uint16_t i = 0; i < len; i++) {
+            vm->ram()->putC(FILE_TEST_NAME + 2 + i, path[i]);
+        }
+        vm->set(REG_SP, FILE_TEST_SP);
+        vm->push(FILE_TEST_NAME);
+        vm->push(mode);
+        syscall_fopen(vm);
+        return vm->pop();
+    }
+
+    void closeFile(uint16_t handle) {
+        vm->push(handle);
+        syscall_fclose(vm);
+    }
+
+    // ( buf -- bytesRead ) the line is left in line
+    int16_t readLine(char *line) {
+        vm->push(FILE_TEST_BUF);
+        syscall_fread(vm);
+        int16_t n = vm->pop();
+        line[0] = '\0';
+        if(n > 0) {
+            uint16_t start = vm->ram()->get(FILE_TEST_BUF);
+            uint16_t end = vm->ram()->get(FILE_TEST_BUF + 2);
+            for(uint16_t i = start; i < end; i++) {
+                *line++ = vm->ram()->getC(i);
+            }
+            *line = '\0';
+        }
+        return n;
+    }
+
+    // ( addr len handle -- written )
+    uint16_t writeText(const char *text, uint16_t handle) {
+        uint16_t len = strlen(text);
+        for(uint16_t i = 0; i < len; i++) {
+            vm->ram()->putC(FILE_TEST_DATA + i, text[i]);
+        }
+        vm->push(FILE_TEST_DATA);
+        vm->push(len);
+        vm->push(handle);
+        syscall_fwrite(vm);
+        return vm->pop();
+    }
+
+    // ( lo hi handle -- success )
+    uint16_t seekFile(uint32_t offset, uint16_t handle) {
+        vm->push(offset & 0xffff);
+        vm->push(offset >> 16);
+        vm->push(handle);
+        syscall_fseek(vm);
+        return vm->pop();
+    }
+
+    void shouldResumeOuterFile() {
+        printf("         shouldResumeOuterFile\n");
+        char line[FILE_LINE_MAX + 1];
+        writeFile(outer, "outer 1\nouter 2\n");
+        writeFile(inner, "inner 1\n");
+        uint16_t o = openFile(outer, FILE_MODE_READ);
+        assert(o != 0, "Should open the outer file");
+        assertEquals(readLine(line), 8, "Outer line and its newline");
+        assertString(line, "outer 1", "First outer line");
+        uint16_t i = openFile(inner, FILE_MODE_READ);
+        assert(i != 0 && i != o, "Should open the inner file");
+        readLine(line);
+        assertString(line, "inner 1", "Reads the innermost file");
+        assertEquals(readLine(line), (uint16_t)-1, "Inner file at EOF");
+        closeFile(0);
+        readLine(line);
+        assertString(line, "outer 2", "Closing the inner file resumes the outer");
+        assertEquals(readLine(line), (uint16_t)-1, "Outer file at EOF");
+        closeFile(0);
+    }
+
+    void shouldSplitLongLine() {
+        printf("         shouldSplitLongLine\n");
+        char text[FILE_LINE_MAX + 8];
+        char line[FILE_LINE_MAX + 1];
+        for(uint16_t i = 0; i < FILE_LINE_MAX + 6; i++) {
+            text[i] = 'A' + (i % 26);
+        }
+        text[FILE_LINE_MAX + 6] = '\n';
+        text[FILE_LINE_MAX + 7] = '\0';
+        writeFile(outer, text);
+        openFile(outer, FILE_MODE_READ);
+        assertEquals(readLine(line), FILE_LINE_MAX, "Cut at FILE_LINE_MAX");
+        assertEquals(strlen(line), FILE_LINE_MAX, "No newline in the first part");
+        assert(strncmp(line, text, FILE_LINE_MAX) == 0, "First FILE_LINE_MAX bytes");
+        assertEquals(readLine(line), 7, "The rest and the newline");
+        assertString(line, "MNOPQR", "The rest of the line");
+        assertEquals(readLine(line), (uint16_t)-1, "Then EOF");
+        closeFile(0);
+    }
+
+    void shouldReadLastLineWithoutNewline() {
+        printf("         shouldReadLastLineWithoutNewline\n");
+        char line[FILE_LINE_MAX + 1];
+        writeFile(outer, "first\nlast");
+        openFile(outer, FILE_MODE_READ);
+        readLine(line);
+        assertEquals(readLine(line), 4, "Just the last line's bytes");
+        assertString(line, "last", "Last line");
+        assertEquals(readLine(line), (uint16_t)-1, "Then EOF");
+        closeFile(0);
+    }
+
+    void shouldRoundTripWriteAndSeek() {
+        printf("         shouldRoundTripWriteAndSeek\n");
+        char line[FILE_LINE_MAX + 1];
+        uint16_t w = openFile(outer, FILE_MODE_WRITE);
+        assert(w != 0, "Should open for writing");
+        assertEquals(writeText("abcdef\n", w), 7, "Written");
+        assertEquals(seekFile(2, w), 1, "Seek the written file");
+        assertEquals(writeText("XY", 0), 2, "Handle 0 is the latest writer");
+        closeFile(w);
+        uint16_t r = openFile(outer, FILE_MODE_READ);
+        readLine(line);
+        assertString(line, "abXYef", "Overwritten in place");
+        assertEquals(seekFile(4, r), 1, "Seek the read file");
+        readLine(line);
+        assertString(line, "ef", "Read from the offset");
+        assertEquals(seekFile(0x10000, 0), 1, "Seek past 64K");
+        assertEquals(readLine(line), (uint16_t)-1, "Nothing past the end");
+        closeFile(r);
+        assertEquals(writeText("lost", 0), 0, "No writer left");
+    }
+
+    void shouldRunOutOfHandles() {
+        printf("         shouldRunOutOfHandles\n");
+        uint16_t handles[FILE_HANDLES];
+        bool opened = true;
+        for(uint16_t i = 0; i < FILE_HANDLES; i++) {
+            handles[i] = openFile(outer, FILE_MODE_READ);
+            opened = opened && handles[i] == i + 1;
+        }
+        assert(opened, "Should number the handles 1 to FILE_HANDLES");
+        assertEquals(openFile(outer, FILE_MODE_READ), 0, "No handle left");
+        closeFile(handles[3]);
+        assertEquals(openFile(outer, FILE_MODE_READ), 4, "Reuses the closed handle");
+        for(uint16_t i = 0; i < FILE_HANDLES; i++) {
+            closeFile(handles[i]);
+        }
+    }
+};
+#endif
@@ -0,0 +1,116 @@
+#ifndef UKMAKER_FORMATTESTS_H
+#define UKMAKER_FORMATTESTS_H
+
+#include "Test.h"
+#include "../runtime/ArduForth/syscalls.h"
+
+#define FORMAT_TEST_SP 0x2f00
+
+/**
+ * The pictured numeric output behind . U. D. and UD. see syscall_format
+ */
+class FormatTests : public Test {
+
+    public:
+    FormatTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    Assembler nasm;
+
+    void run() {
+        if(!shouldAssembleFormat()) {
+            return;
+        }
+        vm->addSyscall(SYSCALL_TYPE, syscall_type);
+        vm->addSyscall(SYSCALL_FORMAT, syscall_format);
+        shouldFormatInAnyBase();
+        shouldFormatNegativeCells();
+        shouldFormatDoubles();
+        shouldPadCells();
+        shouldFallBackToDecimal();
+        Serial.setSink(SERIAL_SINK_STDOUT);
+    }
+
+    bool shouldAssembleFormat() {
+        printf("         shouldAssembleFormat\n");
+        return assembleInto(nasm, "tests/test-format.fasm");
+    }
+
+    // Run the test program on ( x base flags ) and return what it typed
+    const char *format(uint16_t x, uint16_t base, uint16_t flags) {
+        vm->reset();
+        vm->set(REG_SP, FORMAT_TEST_SP);
+        vm->push(x);
+        return runFormat(base, flags);
+    }
+
+    // As format for ( d base flags )
+    const char *formatDouble(uint32_t d, uint16_t base, uint16_t flags) {
+        vm->reset();
+        vm->set(REG_SP, FORMAT_TEST_SP);
+        vm->push(d & 0xffff);
+        vm->push(d >> 16);
+        return runFormat(base, flags | FORMAT_DOUBLE);
+    }
+
+    const char *runFormat(uint16_t base, uint16_t flags) {
+        vm->push(base);
+        vm->push(flags);
+        vm->set(REG_PC, nasm.getLabelAddress("START"));
+        Serial.setSink(SERIAL_SINK_BUFFER);
+        Serial.clearCaptured();
+        vm->run();
+        Serial.setSink(SERIAL_SINK_STDOUT);
+        return Serial.captured();
+    }
+
+    void shouldFormatInAnyBase() {
+        printf("         shouldFormatInAnyBase\n");
+        assertString(format(10, 2, 0), "1010", "Binary");
+        assertString(format(0x7abc, 16, 0), "7abc", "Hex");
+        assertString(format(1295, 36, 0), "zz", "Base 36");
+        assertString(format(0, 36, 0), "0", "Zero");
+        assertString(format(12345, 10, 0), "12345", "Decimal");
+    }
+
+    void shouldFormatNegativeCells() {
+        printf("         shouldFormatNegativeCells\n");
+        assertString(format(-5, 10, 0), "-5", "Signed decimal");
+        assertString(format(-1, 16, 0), "-1", "Signed hex");
+        assertString(format(0x8000, 10, 0), "-32768", "Most negative");
+        assertString(format(-5, 10, FORMAT_UNSIGNED), "65531", "Unsigned decimal");
+        assertString(format(-1, 2, FORMAT_UNSIGNED), "1111111111111111", "Unsigned binary");
+    }
+
+    void shouldFormatDoubles() {
+        printf("         shouldFormatDoubles\n");
+        assertString(formatDouble(70000, 10, 0), "70000", "Double");
+        assertString(formatDouble(-70000, 10, 0), "-70000", "Negative double");
+        assertString(formatDouble(0xffffffff, 2, 0), "-1", "-1 -1 D. in binary");
+        assertString(formatDouble(0xffffffff, 10, FORMAT_UNSIGNED), "4294967295", "-1 -1 UD.");
+        const char *text = formatDouble(0x80000000, 2, 0);
+        assertEquals(strlen(text), FORMAT_MAX, "Most negative double in binary is FORMAT_MAX long");
+        assert(text[0] == '-' && text[1] == '1' && strspn(text + 2, "0") == 31, "Sign, one and 31 zeros");
+        text = formatDouble(0xffffffff, 2, FORMAT_UNSIGNED);
+        assertEquals(strlen(text), 32, "-1 -1 UD. in binary");
+        assertEquals(strspn(text, "1"), 32, "All ones");
+    }
+
+    void shouldPadCells() {
+        printf("         shouldPadCells\n");
+        assertString(format(0x2a, 16, FORMAT_CELL), "002a", "Hex at full width");
+        assertString(format(-1, 16, FORMAT_CELL), "ffff", "Hex is unsigned");
+        assertString(format(5, 2, FORMAT_CELL), "0000000000000101", "Binary at full width");
+        assertString(format(-5, 10, FORMAT_CELL), "-5", "Decimal is signed, not padded");
+        assertString(format(35, 36, FORMAT_CELL), "z", "Other bases not padded");
+        assertString(formatDouble(0x2a, 16, FORMAT_CELL), "0000002a", "Double hex at full width");
+    }
+
+    void shouldFallBackToDecimal() {
+        printf("         shouldFallBackToDecimal\n");
+        assertString(format(42, 0, 0), "42", "BASE 0");
+        assertString(format(42, 1, 0), "42", "BASE 1");
+        assertString(format(42, 37, 0), "42", "BASE 37");
+        assertString(format(-1, 37, FORMAT_CELL), "-1", "As . in decimal");
+    }
+};
+#endif
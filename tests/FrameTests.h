@@ -0,0 +1,87 @@
+#ifndef UKMAKER_FRAMETESTS_H
+#define UKMAKER_FRAMETESTS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Test.h"
+#include "../runtime/ArduForth/syscalls.h"
+#include "../tools/FrameDecoder.h"
+
+class FrameTests : public Test {
+
+    public:
+    FrameTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    Assembler frasm;
+
+    void run() {
+        if(!shouldAssembleFrame()) {
+            return;
+        }
+        vm->addSyscall(SYSCALL_FRAME, syscall_frame);
+        shouldSendFrame();
+        shouldDecodeFrame();
+        shouldRejectBadCrc();
+    }
+
+    bool shouldAssembleFrame() {
+        printf("         shouldAssembleFrame\n");
+        return assembleInto(frasm, "tests/test-frame.fasm");
+    }
+
+    // Run the test program, @return the length of the record it sent
+    size_t sendFrame(uint8_t *rec) {
+        Serial.setSink(SERIAL_SINK_BUFFER);
+        Serial.clearCaptured();
+        vm->reset();
+        vm->set(REG_PC, frasm.getLabelAddress("START"));
+        vm->run();
+        Serial.setSink(SERIAL_SINK_STDOUT);
+        size_t len = Serial.capturedLength();
+        memcpy(rec, Serial.captured(), len < FRAME_MAX ? len : FRAME_MAX);
+        return len;
+    }
+
+    void shouldSendFrame() {
+        printf("         shouldSendFrame\n");
+        uint8_t rec[FRAME_MAX];
+        size_t len = sendFrame(rec);
+        assertEquals(len, 13, "Header, two tagged values and the CRC");
+        const uint8_t body[] = { FRAME_SYNC, 9, 7, FRAME_TAG_CELL, 0x34, 0x12,
+            FRAME_TAG_DOUBLE, 0x70, 0x11, 0x01, 0x00 };
+        assert(memcmp(rec, body, sizeof(body)) == 0, "Record bytes");
+        uint16_t crc = frame_crc(body + 1, sizeof(body) - 1);
+        assertEquals(rec[11] | (rec[12] << 8), crc, "CRC");
+    }
+
+    void shouldDecodeFrame() {
+        printf("         shouldDecodeFrame\n");
+        uint8_t rec[FRAME_MAX];
+        size_t len = sendFrame(rec);
+        char text[256] = "";
+        FILE *out = fmemopen(text, sizeof(text), "w");
+        FrameDecoder decoder(out);
+        decoder.feed(rec, len);
+        fflush(out);
+        assertString(text, "7 4660 70000\n", "Decoded record");
+        assertEquals(decoder.records(), 1, "One record");
+        fclose(out);
+    }
+
+    void shouldRejectBadCrc() {
+        printf("         shouldRejectBadCrc\n");
+        uint8_t rec[FRAME_MAX];
+        size_t len = sendFrame(rec);
+        rec[4] ^= 0xff;
+        char text[256] = "";
+        FILE *out = fmemopen(text, sizeof(text), "w");
+        FrameDecoder decoder(out);
+        decoder.feed(rec, len);
+        fflush(out);
+        assertString(text, "", "Nothing decoded");
+        assertEquals(decoder.bad(), 1, "One bad record");
+        fclose(out);
+    }
+};
+#endif
@@ -0,0 +1,77 @@
+#ifndef UKMAKER_HEADERTESTS_H
+#define UKMAKER_HEADERTESTS_H
+
+#include "Test.h"
+#include "../tools/Dumper.h"
+
+class HeaderTests : public Test {
+
+    public:
+    HeaderTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    // A private assembler, #HEADERS must not leak into the core build
+    Assembler hasm;
+    Assembler basm;
+
+    void run() {
+        if(!shouldAssembleHeaders()) {
+            return;
+        }
+        shouldSeparateHeaders();
+        shouldKeepCodeContiguous();
+        shouldRefuseTurnkeyReachingOuter();
+        shouldBootIntoApplication();
+    }
+
+    bool shouldAssembleHeaders() {
+        printf("         shouldAssembleHeaders\n");
+        return assembleInto(hasm, "tests/test-headers.fasm");
+    }
+
+    void shouldSeparateHeaders() {
+        printf("         shouldSeparateHeaders\n");
+        uint16_t one = hasm.getLabelAddress("ONE");
+        uint16_t two = hasm.getLabelAddress("TWO");
+        assertEquals(one, 512, "First header at #HEADERS");
+        assertEquals(vm->read(one), 0x9003, "Length with the separate bit");
+        assertEquals(vm->read(one + 8), hasm.getLabelAddress("ONE_WA"), "Points to the code field");
+        assertEquals(two, one + 10, "Headers are contiguous");
+        assertEquals(vm->read(two + 6), one, "Link");
+        assertEquals(vm->read(two + 8), 260, "Points to an unlabelled code field");
+    }
+
+    void shouldKeepCodeContiguous() {
+        printf("         shouldKeepCodeContiguous\n");
+        assertEquals(hasm.getLabelAddress("ONE_WA"), 256, "Code starts at the ORG");
+        assertEquals(hasm.getLabelAddress("CODE_END"), 262, "Only code in between");
+    }
+
+    void shouldRefuseTurnkeyReachingOuter() {
+        printf("         shouldRefuseTurnkeyReachingOuter\n");
+        if(!assembleInto(basm, "tests/test-boot.fasm")) {
+            return;
+        }
+        Dumper dumper;
+        assert(basm.reaches("OUTER"), "START runs OUTER");
+        assert(!basm.reaches("APP"), "Nothing runs APP");
+        assert(!dumper.writeTurnkeyCPP("tests/turnkey.h", &basm, vm->ram(), false), "Not written");
+        FILE *fp = fopen("tests/turnkey.h", "r");
+        assert(fp == NULL, "No image left behind");
+        if(fp != NULL) {
+            fclose(fp);
+        }
+    }
+
+    void shouldBootIntoApplication() {
+        printf("         shouldBootIntoApplication\n");
+        Assembler app;
+        app.setBoot("APP_WA");
+        if(!assembleInto(app, "tests/test-boot.fasm")) {
+            return;
+        }
+        assertEquals(vm->read(app.getLabelAddress("BOOT")), app.getLabelAddress("APP_WA"), "BOOT runs APP");
+        assert(app.reaches("APP"), "START runs APP");
+        assert(!app.reaches("OUTER"), "OUTER is left behind");
+    }
+};
+#endif
@@ -0,0 +1,81 @@
+#ifndef UKMAKER_JITTESTS_H
+#define UKMAKER_JITTESTS_H
+
+#include "Test.h"
+#include "../tools/TraceJIT.h"
+
+class JitTests : public Test {
+
+    public:
+    JitTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader),
+        jit(fvm->ram()), jvm(&jit, NULL, 0) {}
+
+    Assembler jasm;
+    // A second VM over the same memory, running through the JIT
+    TraceJIT jit;
+    ForthVM jvm;
+
+    void run() {
+        if(!shouldAssembleJit()) {
+            return;
+        }
+        shouldMatchTheInterpreter();
+        shouldInvalidateOnWrite();
+        shouldInvalidateOnBulkWrite();
+        jvm.setJit(NULL);
+    }
+
+    bool shouldAssembleJit() {
+        printf("         shouldAssembleJit\n");
+        if(!assembleInto(jasm, "tests/test-jit.fasm")) {
+            return false;
+        }
+        jvm.setJit(&jit);
+        return true;
+    }
+
+    uint16_t interpret() {
+        vm->reset();
+        vm->set(REG_PC, jasm.getLabelAddress("START"));
+        vm->run();
+        return vm->get(REG_A);
+    }
+
+    uint16_t compiled() {
+        jvm.reset();
+        jvm.set(REG_PC, jasm.getLabelAddress("START"));
+        jvm.run();
+        return jvm.get(REG_A);
+    }
+
+    void shouldMatchTheInterpreter() {
+        printf("         shouldMatchTheInterpreter\n");
+        assertEquals(interpret(), 200, "Interpreted");
+        assertEquals(compiled(), 200, "Traced");
+        assert(jit.translated() > 0, "Should translate the loop");
+        assert(jit.entered() > 0, "Should run the loop as a trace");
+    }
+
+    void shouldInvalidateOnWrite() {
+        printf("         shouldInvalidateOnWrite\n");
+        uint16_t step = jasm.getLabelAddress("STEP");
+        jvm.ram()->put(step, (OP_ADDI << OP_BITS) | (REG_A << ARGA_BITS) | 2);
+        assert(jit.invalidations() > 0, "Should drop the traces through STEP");
+        assertEquals(compiled(), 400, "Traced after the patch");
+        assertEquals(interpret(), 400, "Interpreted after the patch");
+    }
+
+    // Writers like Blocks copy straight into RAM unless inRam says no
+    void shouldInvalidateOnBulkWrite() {
+        printf("         shouldInvalidateOnBulkWrite\n");
+        uint16_t step = jasm.getLabelAddress("STEP");
+        uint16_t addi = (OP_ADDI << OP_BITS) | (REG_A << ARGA_BITS) | 1;
+        uint32_t before = jit.invalidations();
+        assert(!jvm.ram()->inRam(step, 2), "Should refuse the bulk path");
+        jvm.ram()->putC(step, addi & 0xff);
+        jvm.ram()->putC(step + 1, addi >> 8);
+        assert(jit.invalidations() > before, "Should drop the traces through STEP");
+        assertEquals(compiled(), 200, "Traced after the copy");
+    }
+};
+#endif
@@ -0,0 +1,106 @@
+#ifndef UKMAKER_LINEREADERTESTS_H
+#define UKMAKER_LINEREADERTESTS_H
+
+#include "Test.h"
+#include "../runtime/ArduForth/LineReader.h"
+
+#define LINE_TEST_BUF 0x2a00
+
+/**
+ * The console receive ring, see LineReader.h. Bytes given to receive()
+ * make a line for line() only once a newline arrives or it is full.
+ */
+class LineReaderTests : public Test {
+
+    public:
+    LineReaderTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    void run() {
+        shouldWaitForNewline();
+        shouldCutAtInlineMax();
+        shouldDropWhenRingFull();
+    }
+
+    void receive(LineReader &lr, const char *text) {
+        while(*text) {
+            lr.receive(*text++);
+        }
+    }
+
+    // The line at LINE_TEST_BUF starts with len bytes of text
+    bool holds(const char *text, uint16_t len) {
+        for(uint16_t i = 0; i < len; i++) {
+            if(vm->ram()->getC(LINE_TEST_BUF + i) != (uint8_t)text[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void shouldWaitForNewline() {
+        printf("         shouldWaitForNewline\n");
+        LineReader lr;
+        receive(lr, "1 2");
+        assertEquals(lr.line(vm->ram(), LINE_TEST_BUF, INLINE_MAX), -1, "Partial line");
+        receive(lr, " +");
+        assertEquals(lr.line(vm->ram(), LINE_TEST_BUF, INLINE_MAX), -1, "Still partial");
+        receive(lr, "\nDUP");
+        assertEquals(lr.line(vm->ram(), LINE_TEST_BUF, INLINE_MAX), 5, "Newline completes the line");
+        assert(holds("1 2 +", 5), "Should hold the line");
+        receive(lr, "\n");
+        assertEquals(lr.line(vm->ram(), LINE_TEST_BUF, INLINE_MAX), 3, "Next line starts after the newline");
+        assert(holds("DUP", 3), "Should hold the next line");
+        receive(lr, "\n");
+        assertEquals(lr.line(vm->ram(), LINE_TEST_BUF, INLINE_MAX), 0, "Empty line");
+    }
+
+    void shouldCutAtInlineMax() {
+        printf("         shouldCutAtInlineMax\n");
+        LineReader lr;
+        char text[INLINE_MAX + 4];
+        for(uint16_t i = 0; i < sizeof(text) - 1; i++) {
+            text[i] = 'A' + (i % 26);
+        }
+        text[sizeof(text) - 1] = '\0';
+        // Drain the ring as it fills, as INLINE would
+        int16_t first = -1;
+        int16_t lines = 0;
+        for(uint16_t i = 0; text[i]; i++) {
+            while(!lr.receive(text[i])) {
+                int16_t len = lr.line(vm->ram(), LINE_TEST_BUF, INLINE_MAX);
+                if(len >= 0) {
+                    first = len;
+                    lines++;
+                }
+            }
+        }
+        int16_t len = lr.line(vm->ram(), LINE_TEST_BUF, INLINE_MAX);
+        if(len >= 0) {
+            first = len;
+            lines++;
+        }
+        assertEquals(lines, 1, "One full line");
+        assertEquals(first, INLINE_MAX, "Cut at INLINE_MAX");
+        assert(holds(text, INLINE_MAX), "Should hold the first INLINE_MAX bytes");
+        receive(lr, "\n");
+        assertEquals(lr.line(vm->ram(), LINE_TEST_BUF, INLINE_MAX), 3, "The rest is the next line");
+        assert(holds(text + INLINE_MAX, 3), "Should hold the rest");
+    }
+
+    void shouldDropWhenRingFull() {
+        printf("         shouldDropWhenRingFull\n");
+        LineReader lr;
+        bool taken = true;
+        for(uint16_t i = 0; i < INLINE_RING - 1; i++) {
+            taken = taken && lr.receive('0' + (i % 10));
+        }
+        assert(taken, "Should take INLINE_RING - 1 bytes");
+        assert(!lr.receive('X'), "Should drop a byte when full");
+        assert(!lr.receive('\n'), "Should drop the newline too");
+        assertEquals(lr.line(vm->ram(), LINE_TEST_BUF, INLINE_MAX), -1, "No newline kept");
+        assert(lr.receive('\n'), "Should take a byte once drained");
+        assertEquals(lr.line(vm->ram(), LINE_TEST_BUF, INLINE_MAX), INLINE_RING - 1, "Only the kept bytes");
+        assert(vm->ram()->getC(LINE_TEST_BUF + INLINE_RING - 2) != 'X', "Dropped byte not in the line");
+    }
+};
+#endif
@@ -0,0 +1,94 @@
+#ifndef UKMAKER_NATIVETESTS_H
+#define UKMAKER_NATIVETESTS_H
+
+#include <string.h>
+#include "Test.h"
+#include "../tools/Dumper.h"
+#include "test-native.h"
+
+#define NATIVE_TEST_FILE "tests/test-native.h"
+#define NATIVE_TEST_NEW "tests/test-native.h.new"
+
+/**
+ * Dumper::writeNative's translation of tests/test-native.fasm is kept in
+ * tests/test-native.h. It must still be what the Dumper writes, and must
+ * give the same results as the interpreter.
+ */
+class NativeTests : public Test {
+
+    public:
+    NativeTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    Assembler nasm;
+
+    void run() {
+#if VM_NATIVE
+        if(!shouldAssembleNative()) {
+            return;
+        }
+        shouldWriteTheSameTranslation();
+        shouldMatchTheInterpreter();
+#endif
+    }
+
+    bool shouldAssembleNative() {
+        printf("         shouldAssembleNative\n");
+        return assembleInto(nasm, "tests/test-native.fasm");
+    }
+
+    // The whole of a file, NULL if it can't be read. The caller frees it
+    char *slurpFile(const char *path) {
+        FILE *fp = fopen(path, "rb");
+        if(fp == NULL) {
+            return NULL;
+        }
+        fseek(fp, 0, SEEK_END);
+        long len = ftell(fp);
+        fseek(fp, 0, SEEK_SET);
+        char *text = (char *)malloc(len + 1);
+        text[fread(text, 1, len, fp)] = '\0';
+        fclose(fp);
+        return text;
+    }
+
+    void shouldWriteTheSameTranslation() {
+        printf("         shouldWriteTheSameTranslation\n");
+        Dumper dumper;
+        assert(dumper.writeNative(NATIVE_TEST_NEW, &nasm, vm->ram(), "Test"), "Should write");
+        char *written = slurpFile(NATIVE_TEST_NEW);
+        char *kept = slurpFile(NATIVE_TEST_FILE);
+        assert(written != NULL && kept != NULL && strcmp(written, kept) == 0,
+            "Should match " NATIVE_TEST_FILE ", regenerate it from " NATIVE_TEST_NEW);
+        if(written != NULL && kept != NULL && strcmp(written, kept) == 0) {
+            remove(NATIVE_TEST_NEW);
+        }
+        free(written);
+        free(kept);
+    }
+
+    // Steps taken to reach HALT from START
+    uint16_t runFromStart(ForthVM &nvm) {
+        uint16_t steps = 0;
+        nvm.reset();
+        nvm.set(REG_PC, nasm.getLabelAddress("START"));
+        while(!nvm.halted()) {
+            nvm.step();
+            steps++;
+        }
+        return steps;
+    }
+
+    void shouldMatchTheInterpreter() {
+        printf("         shouldMatchTheInterpreter\n");
+        ForthVM nvm(vm->ram(), NULL, 0);
+        uint16_t interpreted = runFromStart(nvm);
+        assertEquals(nvm.get(REG_A), 55, "Interpreted");
+        nvm.setNative(testNative, TEST_NATIVE_COUNT);
+        uint16_t translated = runFromStart(nvm);
+        assertEquals(nvm.get(REG_A), 55, "Translated");
+        assertEquals(nvm.get(REG_SP), 0x2f00, "Data stack balanced");
+        assertEquals(nvm.get(REG_RS), 0x2e00, "Return stack balanced");
+        assert(translated < interpreted, "Should run blocks as single steps");
+    }
+};
+#endif
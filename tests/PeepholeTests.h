@@ -0,0 +1,239 @@
+#ifndef UKMAKER_PEEPHOLETESTS_H
+#define UKMAKER_PEEPHOLETESTS_H
+
+#include "Test.h"
+#include "../runtime/ArduForth/syscalls.h"
+
+#define PEEP_TEST_TABLE 0x300
+#define PEEP_TEST_DP 0x380
+#define PEEP_TEST_OPTIMIZE 0x382
+#define PEEP_TEST_DEPTH 0x384
+#define PEEP_TEST_HISTORY 0x386
+#define PEEP_TEST_CURRENT 0x390
+#define PEEP_TEST_INLINE 0x392
+#define PEEP_TEST_LATEST 0x394
+#define PEEP_TEST_STC 0x396
+#define PEEP_TEST_ISLAND 0x398
+#define PEEP_TEST_MODE 0x39a
+#define PEEP_TEST_REJECT 0x3a0
+#define PEEP_TEST_HERE 0x400
+#define PEEP_TEST_SP 0x2fe
+
+class PeepholeTests : public Test {
+
+    public:
+    PeepholeTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    void run() {
+        shouldFoldLiterals();
+        shouldUseShortcuts();
+        shouldNotLookPastBarrier();
+        shouldCompileTailCall();
+        shouldInlineShortWords();
+        shouldCompileSubroutineThreaded();
+        shouldRefuseThreadedWordsInStc();
+    }
+
+    // Word addresses are just distinct numbers here
+    void setup() {
+        Memory *ram = vm->ram();
+        vm->set(REG_SP, PEEP_TEST_SP);
+        ram->put(PEEP_TEST_TABLE + (PEEP_DP << 1), PEEP_TEST_DP);
+        ram->put(PEEP_TEST_TABLE + (PEEP_OPTIMIZE << 1), PEEP_TEST_OPTIMIZE);
+        ram->put(PEEP_TEST_TABLE + (PEEP_DEPTH << 1), PEEP_TEST_DEPTH);
+        ram->put(PEEP_TEST_TABLE + (PEEP_HISTORY << 1), PEEP_TEST_HISTORY);
+        for(uint8_t i = PEEP_LIT; i <= PEEP_CONSTANT; i++) {
+            ram->put(PEEP_TEST_TABLE + (i << 1), 0x1000 + i);
+        }
+        ram->put(PEEP_TEST_TABLE + (PEEP_CURRENT << 1), PEEP_TEST_CURRENT);
+        ram->put(PEEP_TEST_TABLE + (PEEP_INLINE << 1), PEEP_TEST_INLINE);
+        ram->put(PEEP_TEST_TABLE + (PEEP_REJECT << 1), PEEP_TEST_REJECT);
+        ram->put(PEEP_TEST_TABLE + (PEEP_STC << 1), PEEP_TEST_STC);
+        ram->put(PEEP_TEST_TABLE + (PEEP_ISLAND << 1), PEEP_TEST_ISLAND);
+        ram->put(PEEP_TEST_TABLE + (PEEP_MODE << 1), PEEP_TEST_MODE);
+        for(uint8_t i = PEEP_STC_COLON; i <= PEEP_NEXT; i++) {
+            ram->put(PEEP_TEST_TABLE + (i << 1), 0x1000 + i);
+        }
+        ram->put(PEEP_TEST_TABLE + (PEEP_NO_ISLAND << 1), PEEP_TEST_REJECT + 2);
+        ram->put(PEEP_TEST_TABLE + (PEEP_STC_THREADED << 1), PEEP_TEST_REJECT + 4);
+        ram->put(PEEP_TEST_STC, 0);
+        ram->put(PEEP_TEST_ISLAND, 0);
+        ram->put(PEEP_TEST_MODE, 1);
+        ram->put(PEEP_TEST_CURRENT, PEEP_TEST_LATEST);
+        ram->put(PEEP_TEST_LATEST, 0x600);
+        ram->put(PEEP_TEST_INLINE, 0);
+        ram->put(PEEP_TEST_REJECT, 0x1000 + PEEP_RFROM);
+        ram->put(PEEP_TEST_REJECT + 2, 0);
+        ram->put(PEEP_TEST_REJECT + 4, 0x640);
+        ram->put(PEEP_TEST_REJECT + 6, 0);
+        ram->put(PEEP_TEST_DP, PEEP_TEST_HERE);
+        ram->put(PEEP_TEST_OPTIMIZE, 1);
+        ram->put(PEEP_TEST_DEPTH, 0);
+    }
+
+    void literal(uint16_t n) {
+        vm->push(n);
+        vm->push(PEEP_TEST_TABLE);
+        syscall_literal(vm);
+    }
+
+    void compile(uint8_t entry) {
+        compileWord(0x1000 + entry);
+    }
+
+    void compileWord(uint16_t wa) {
+        vm->push(wa);
+        vm->push(PEEP_TEST_TABLE);
+        syscall_compile(vm);
+    }
+
+    uint16_t here() {
+        return vm->read(PEEP_TEST_DP) - PEEP_TEST_HERE;
+    }
+
+    void shouldFoldLiterals() {
+        printf("         shouldFoldLiterals\n");
+        setup();
+        literal(1);
+        literal(2);
+        literal(3);
+        compile(PEEP_PLUS);
+        compile(PEEP_TIMES);
+        assertEquals(here(), 4, "Should leave one literal");
+        assertEquals(vm->read(PEEP_TEST_HERE), 0x1000 + PEEP_LIT, "Literal");
+        assertEquals(vm->read(PEEP_TEST_HERE + 2), 5, "Value");
+    }
+
+    void shouldUseShortcuts() {
+        printf("         shouldUseShortcuts\n");
+        setup();
+        compile(PEEP_SWAP);
+        literal(1);
+        compile(PEEP_PLUS);
+        compile(PEEP_SWAP);
+        compile(PEEP_DROP);
+        assertEquals(here(), 6, "Should compile three words");
+        assertEquals(vm->read(PEEP_TEST_HERE + 2), 0x1000 + PEEP_ONEPLUS, "1+");
+        assertEquals(vm->read(PEEP_TEST_HERE + 4), 0x1000 + PEEP_NIP, "NIP");
+    }
+
+    void shouldNotLookPastBarrier() {
+        printf("         shouldNotLookPastBarrier\n");
+        setup();
+        literal(1);
+        vm->ram()->put(PEEP_TEST_DEPTH, 0);
+        compile(PEEP_PLUS);
+        assertEquals(here(), 6, "Should not fold");
+        vm->ram()->put(PEEP_TEST_OPTIMIZE, 0);
+        literal(2);
+        literal(3);
+        compile(PEEP_PLUS);
+        assertEquals(here(), 16, "Should not fold when turned off");
+    }
+
+    void shouldCompileTailCall() {
+        printf("         shouldCompileTailCall\n");
+        setup();
+        // A colon word, and one which starts with R>
+        vm->ram()->put(0x500, 0x1000 + PEEP_COLON);
+        vm->ram()->put(0x502, 0x1000 + PEEP_DROP);
+        vm->ram()->put(0x510, 0x1000 + PEEP_COLON);
+        vm->ram()->put(0x512, 0x1000 + PEEP_RFROM);
+        compileWord(0x510);
+        compile(PEEP_SEMI);
+        assertEquals(vm->read(PEEP_TEST_HERE), 0x510, "Should keep the call");
+        setup();
+        compileWord(0x500);
+        compile(PEEP_SEMI);
+        assertEquals(here(), 6, "Should compile *TAIL and SEMI");
+        assertEquals(vm->read(PEEP_TEST_HERE), 0x1000 + PEEP_TAIL, "*TAIL");
+        assertEquals(vm->read(PEEP_TEST_HERE + 2), 0x502, "Body");
+        assertEquals(vm->read(PEEP_TEST_HERE + 4), 0x1000 + PEEP_SEMI, "SEMI");
+    }
+
+    void shouldInlineShortWords() {
+        printf("         shouldInlineShortWords\n");
+        setup();
+        vm->ram()->put(PEEP_TEST_INLINE, 3);
+        // : A 2 + ;  : B SWAP R> DROP ;  : C DUP DUP DUP DUP ;  7 CONSTANT D
+        uint16_t a[] = { 0x1000 + PEEP_COLON, 0x1000 + PEEP_LIT, 2, 0x1000 + PEEP_PLUS, 0x1000 + PEEP_SEMI };
+        uint16_t b[] = { 0x1000 + PEEP_COLON, 0x1000 + PEEP_SWAP, 0x1000 + PEEP_RFROM, 0x1000 + PEEP_DROP, 0x1000 + PEEP_SEMI };
+        uint16_t c[] = { 0x1000 + PEEP_COLON, 0x1000 + PEEP_DROP, 0x1000 + PEEP_DROP, 0x1000 + PEEP_DROP, 0x1000 + PEEP_DROP, 0x1000 + PEEP_SEMI };
+        for(uint8_t i = 0; i < 5; i++) vm->ram()->put(0x500 + (i << 1), a[i]);
+        for(uint8_t i = 0; i < 5; i++) vm->ram()->put(0x520 + (i << 1), b[i]);
+        for(uint8_t i = 0; i < 6; i++) vm->ram()->put(0x540 + (i << 1), c[i]);
+        vm->ram()->put(0x560, 0x1000 + PEEP_CONSTANT);
+        vm->ram()->put(0x562, 7);
+        literal(1);
+        compileWord(0x500);
+        assertEquals(here(), 4, "Should inline and fold");
+        assertEquals(vm->read(PEEP_TEST_HERE + 2), 3, "Folded value");
+        compileWord(0x560);
+        assertEquals(vm->read(PEEP_TEST_HERE + 6), 7, "Constant as a literal");
+        compileWord(0x520);
+        compileWord(0x540);
+        assertEquals(here(), 12, "Should call words using R> and long words");
+        vm->ram()->put(PEEP_TEST_LATEST, 0x4f0);
+        compileWord(0x500);
+        assertEquals(vm->read(PEEP_TEST_HERE + 12), 0x500, "Should not inline the latest word");
+    }
+
+    void shouldCompileSubroutineThreaded() {
+        printf("         shouldCompileSubroutineThreaded\n");
+        setup();
+        vm->ram()->put(PEEP_TEST_STC, 1);
+        vm->ram()->put(PEEP_TEST_LATEST, 0x3f0);
+        // An STC word, a colon word and + as a primitive
+        vm->ram()->put(0x500, 0x1000 + PEEP_STC_COLON);
+        vm->ram()->put(0x520, 0x1000 + PEEP_COLON);
+        uint16_t plus[] = { 0x702,
+            (OP_POPD << OP_BITS) | (REG_A << ARGA_BITS),
+            (OP_POPD << OP_BITS) | (REG_B << ARGA_BITS),
+            (OP_ADD << OP_BITS) | (REG_A << ARGA_BITS) | REG_B,
+            (OP_PUSHD << OP_BITS) | (REG_A << ARGA_BITS),
+            OP_JP << OP_BITS, 0x1000 + PEEP_NEXT };
+        for(uint8_t i = 0; i < 7; i++) vm->ram()->put(0x700 + (i << 1), plus[i]);
+        compileWord(0x500);
+        literal(5);
+        compileWord(0x700);
+        compileWord(0x520);
+        compile(PEEP_SEMI);
+        assertEquals(here(), 28, "Should compile native code and an island");
+        assertEquals(vm->read(PEEP_TEST_HERE), OP_CALL << OP_BITS, "CALL");
+        assertEquals(vm->read(PEEP_TEST_HERE + 2), 0x502, "Body");
+        assertEquals(vm->read(PEEP_TEST_HERE + 6), 5, "Literal");
+        assertEquals(vm->read(PEEP_TEST_HERE + 10), plus[1], "Copied primitive");
+        assertEquals(vm->read(PEEP_TEST_HERE + 20), 0x1000 + PEEP_STC_ITC, "Island");
+        assertEquals(vm->read(PEEP_TEST_HERE + 22), 0x520, "Threaded call");
+        assertEquals(vm->read(PEEP_TEST_HERE + 24), 0x1000 + PEEP_STC_NATIVE, "End of island");
+        assertEquals(vm->read(PEEP_TEST_HERE + 26), OP_RET << OP_BITS, "RET");
+        setup();
+        vm->ram()->put(PEEP_TEST_STC, 1);
+        vm->ram()->put(PEEP_TEST_LATEST, 0x3f0);
+        compileWord(0x500);
+        compile(PEEP_SEMI);
+        assertEquals(here(), 4, "Should compile a tail call");
+        assertEquals(vm->read(PEEP_TEST_HERE), OP_JP << OP_BITS, "JP");
+    }
+
+    uint16_t threaded(uint16_t na) {
+        vm->push(na);
+        vm->push(PEEP_TEST_TABLE);
+        syscall_threaded(vm);
+        return vm->pop();
+    }
+
+    void shouldRefuseThreadedWordsInStc() {
+        printf("         shouldRefuseThreadedWordsInStc\n");
+        setup();
+        assertEquals(threaded(0x640), 0, "Anything goes without STC");
+        vm->ram()->put(PEEP_TEST_STC, 1);
+        vm->ram()->put(PEEP_TEST_LATEST, 0x3f0);
+        vm->ram()->put(PEEP_TEST_ISLAND, PEEP_TEST_HERE + 4);
+        assertEquals(threaded(0x660), 0, "Other words are compiled");
+        assertEquals(vm->read(PEEP_TEST_ISLAND), PEEP_TEST_HERE + 4, "Island left open");
+        assertEquals(threaded(0x640), 1, "Listed word is refused");
+        assertEquals(vm->read(PEEP_TEST_ISLAND), 0, "Island closed");
+    }
+};
+#endif
@@ -0,0 +1,59 @@
+#ifndef UKMAKER_RECORDINGTESTS_H
+#define UKMAKER_RECORDINGTESTS_H
+
+#include "Test.h"
+#include "../tools/RecordingMemory.h"
+
+#define RECORD_TEST_DATA 0x2800
+#define RECORD_TEST_DS_LIMIT 0x2e00
+#define RECORD_TEST_DS_TOP 0x2f00
+
+/**
+ * RecordingMemory's per-region counts for tests/test-record.fasm, run on
+ * a VM of its own without native stacks so every push and pop is seen.
+ */
+class RecordingTests : public Test {
+
+    public:
+    RecordingTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    Assembler rasm;
+
+    void run() {
+        if(!shouldAssembleRecording()) {
+            return;
+        }
+        shouldCountRegionAccesses();
+    }
+
+    bool shouldAssembleRecording() {
+        printf("         shouldAssembleRecording\n");
+        return assembleInto(rasm, "tests/test-record.fasm");
+    }
+
+    void shouldCountRegionAccesses() {
+        printf("         shouldCountRegionAccesses\n");
+        RecordingMemory rec(vm->ram());
+        rec.addRegion("CODE", rasm.getLabelAddress("START"), rasm.getLabelAddress("END"));
+        rec.addRegion("DATA", RECORD_TEST_DATA, RECORD_TEST_DATA + 2);
+        rec.addRegion("DSTACK", RECORD_TEST_DS_LIMIT, RECORD_TEST_DS_TOP + 2);
+        rec.setDataStack(RECORD_TEST_DS_LIMIT, RECORD_TEST_DS_TOP);
+        rec.clear();
+
+        ForthVM rvm(&rec, NULL, 0);
+        rvm.reset();
+        rvm.set(REG_PC, rasm.getLabelAddress("START"));
+        rvm.run();
+        assertEquals(rvm.get(REG_A), 10, "Should add 4 down to 1");
+
+        // Four two word MOVILs and PUSHD, 7 in the loop 4 times, POPD and HALT
+        assertEquals(rec.regionReads(0), 4 * 2 + 1 + 4 * 7 + 2, "CODE reads, one per instruction word");
+        assertEquals(rec.regionWrites(0), 0, "CODE writes");
+        assertEquals(rec.regionReads(1), 4, "DATA reads");
+        assertEquals(rec.regionWrites(1), 4, "DATA writes");
+        assertEquals(rec.regionReads(2), 5, "DSTACK reads");
+        assertEquals(rec.regionWrites(2), 5, "DSTACK writes");
+        assertEquals(rec.dataStackHighWater(), 0, "Only the top cell used");
+    }
+};
+#endif
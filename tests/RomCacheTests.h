@@ -0,0 +1,99 @@
+#ifndef UKMAKER_ROMCACHETESTS_H
+#define UKMAKER_ROMCACHETESTS_H
+
+#include "Test.h"
+#include "../runtime/ArduForth/UnsafeMemory.h"
+
+#define ROM_CACHE_TEST_RAM 0x100
+
+/**
+ * UnsafeMemory's direct mapped ROM cache, on in the host build. Each ROM
+ * word maps to line (addr / 2) % ROM_CACHE_WORDS.
+ */
+class RomCacheTests : public Test {
+
+    public:
+    RomCacheTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    void run() {
+#if ROM_CACHE_WORDS > 0
+        shouldCountHitsAndMisses();
+        shouldEvictOnConflict();
+        shouldInvalidateOnStore();
+#endif
+    }
+
+#if ROM_CACHE_WORDS > 0
+    uint8_t ram[64];
+    uint8_t rom[ROM_CACHE_WORDS * 4];
+
+    // ROM at 0 holding its own word addresses, two words for each line
+    void fill() {
+        for(uint16_t i = 0; i < sizeof(rom); i += 2) {
+            rom[i] = i & 0xff;
+            rom[i + 1] = i >> 8;
+        }
+    }
+
+    void assertCounts(UnsafeMemory &tmem, uint32_t hits, uint32_t misses, const char *msg) {
+        char text[80];
+        snprintf(text, sizeof(text), "%s hits", msg);
+        assertEquals(tmem.romCacheHits(), hits, text);
+        snprintf(text, sizeof(text), "%s misses", msg);
+        assertEquals(tmem.romCacheMisses(), misses, text);
+    }
+
+    void shouldCountHitsAndMisses() {
+        printf("         shouldCountHitsAndMisses\n");
+        fill();
+        UnsafeMemory tmem(ram, sizeof(ram), ROM_CACHE_TEST_RAM, rom, sizeof(rom), 0);
+        assertCounts(tmem, 0, 0, "Empty");
+        assertEquals(tmem.get(4), 4, "Miss reads ROM");
+        assertCounts(tmem, 0, 1, "First read");
+        assertEquals(tmem.get(4), 4, "Hit reads the cache");
+        assertCounts(tmem, 1, 1, "Second read");
+        tmem.get(6);
+        tmem.get(6);
+        assertCounts(tmem, 2, 2, "Next line");
+        tmem.put(ROM_CACHE_TEST_RAM, 0x1234);
+        assertEquals(tmem.get(ROM_CACHE_TEST_RAM), 0x1234, "RAM read");
+        tmem.getC(4);
+        assertCounts(tmem, 2, 2, "RAM and byte reads not counted");
+        tmem.clearRomCache();
+        tmem.get(4);
+        assertCounts(tmem, 0, 1, "Cleared");
+    }
+
+    void shouldEvictOnConflict() {
+        printf("         shouldEvictOnConflict\n");
+        fill();
+        UnsafeMemory tmem(ram, sizeof(ram), ROM_CACHE_TEST_RAM, rom, sizeof(rom), 0);
+        uint16_t other = ROM_CACHE_WORDS * 2 + 4; // Same line as 4
+        tmem.get(4);
+        assertEquals(tmem.get(other), other, "Conflicting word");
+        assertEquals(tmem.get(4), 4, "Evicted word reread");
+        assertCounts(tmem, 0, 3, "Each read misses");
+    }
+
+    void shouldInvalidateOnStore() {
+        printf("         shouldInvalidateOnStore\n");
+        fill();
+        UnsafeMemory tmem(ram, sizeof(ram), ROM_CACHE_TEST_RAM, rom, sizeof(rom), 0);
+        tmem.get(4);
+        tmem.put(4, 0xbeef);
+        assertEquals(tmem.get(4), 0xbeef, "Should see the stored word");
+        assertCounts(tmem, 0, 2, "Store invalidates");
+        tmem.putC(5, 0xca);
+        assertEquals(tmem.get(4), 0xcaef, "Should see the stored high byte");
+        tmem.get(2);
+        tmem.putC(3, 0x12);
+        assertEquals(tmem.get(2), 0x1202, "Should see a byte stored in the word before");
+        tmem.putC(4, 0x55);
+        assertEquals(tmem.get(4), 0xca55, "Should see the stored low byte");
+        assertCounts(tmem, 0, 6, "Byte stores invalidate");
+        tmem.get(4);
+        assertCounts(tmem, 1, 6, "Cached again");
+    }
+#endif
+};
+#endif
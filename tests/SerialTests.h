@@ -0,0 +1,102 @@
+#ifndef UKMAKER_SERIALTESTS_H
+#define UKMAKER_SERIALTESTS_H
+
+#include <string.h>
+#include "Test.h"
+#include "../runtime/ArduForth/syscalls.h"
+#include "../runtime/ArduForth/UnsafeMemory.h"
+
+// Longer than TYPE_CHUNK so a ROM copy takes more than one block
+#define SERIAL_TEST_TEXT "The quick brown fox jumps over the lazy dog, twice over"
+
+class SerialTests : public Test {
+
+    public:
+    SerialTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    Assembler sasm;
+
+    void run() {
+        if(!shouldAssembleSerial()) {
+            return;
+        }
+        vm->addSyscall(SYSCALL_TYPELN, syscall_typeln);
+        vm->addSyscall(SYSCALL_DOT, syscall_dot);
+        shouldCaptureOutput();
+        shouldDiscardOutput();
+        shouldTypeFromRam();
+        shouldTypeFromRomInChunks();
+        Serial.setSink(SERIAL_SINK_STDOUT);
+    }
+
+    bool shouldAssembleSerial() {
+        printf("         shouldAssembleSerial\n");
+        return assembleInto(sasm, "tests/test-serial.fasm");
+    }
+
+    void runSerial() {
+        vm->reset();
+        vm->set(REG_PC, sasm.getLabelAddress("START"));
+        vm->run();
+    }
+
+    void shouldCaptureOutput() {
+        printf("         shouldCaptureOutput\n");
+        Serial.setSink(SERIAL_SINK_BUFFER);
+        Serial.clearCaptured();
+        runSerial();
+        Serial.setSink(SERIAL_SINK_STDOUT);
+        assertString(Serial.captured(), "Hello\n42", "Captured output");
+    }
+
+    void shouldDiscardOutput() {
+        printf("         shouldDiscardOutput\n");
+        Serial.clearCaptured();
+        Serial.setSink(SERIAL_SINK_NULL);
+        runSerial();
+        Serial.setSink(SERIAL_SINK_STDOUT);
+        assertEquals(Serial.capturedLength(), 0, "Nothing captured");
+    }
+
+    // Put a counted string at addr
+    void putString(Memory *mem, uint16_t addr, const char *text) {
+        uint16_t len = strlen(text);
+        mem->put(addr, len);
+        for(uint16_t i = 0; i < len; i++) {
+            mem->putC(addr + 2 + i, text[i]);
+        }
+    }
+
+    // TYPE the counted string at addr and return what was written
+    const char *typeCaptured(ForthVM *tvm, uint16_t addr) {
+        Serial.setSink(SERIAL_SINK_BUFFER);
+        Serial.clearCaptured();
+        tvm->push(addr);
+        syscall_type(tvm);
+        Serial.setSink(SERIAL_SINK_STDOUT);
+        return Serial.captured();
+    }
+
+    void shouldTypeFromRam() {
+        printf("         shouldTypeFromRam\n");
+        uint16_t text = 0x2800;
+        putString(vm->ram(), text, SERIAL_TEST_TEXT);
+        vm->set(REG_SP, 0x2f00);
+        assert(vm->ram()->inRam(text + 2, strlen(SERIAL_TEST_TEXT)), "Should take the bulk path");
+        assertString(typeCaptured(vm, text), SERIAL_TEST_TEXT, "RAM string");
+    }
+
+    void shouldTypeFromRomInChunks() {
+        printf("         shouldTypeFromRomInChunks\n");
+        uint8_t rom[128] = {0};
+        uint8_t ram[64];
+        UnsafeMemory tmem(ram, sizeof(ram), 0x100, rom, sizeof(rom), 0);
+        putString(&tmem, 0, SERIAL_TEST_TEXT);
+        ForthVM tvm(&tmem, NULL, 0);
+        tvm.set(REG_SP, 0x13e);
+        assert(!tmem.inRam(2, strlen(SERIAL_TEST_TEXT)), "Should take the chunked path");
+        assert(strlen(SERIAL_TEST_TEXT) > TYPE_CHUNK, "Should take more than one chunk");
+        assertString(typeCaptured(&tvm, 0), SERIAL_TEST_TEXT, "ROM string");
+    }
+};
+#endif
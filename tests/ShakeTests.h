@@ -0,0 +1,59 @@
+#ifndef UKMAKER_SHAKETESTS_H
+#define UKMAKER_SHAKETESTS_H
+
+#include "Test.h"
+
+class ShakeTests : public Test {
+
+    public:
+    ShakeTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    // A private assembler, the roots must not leak into the core build
+    Assembler sasm;
+
+    void run() {
+        if(!shouldAssembleShaken()) {
+            return;
+        }
+        shouldDropUnreachableWords();
+        shouldRelinkPastDroppedWords();
+        shouldKeepOuterOnlyAsBoot();
+    }
+
+    bool shouldAssembleShaken() {
+        printf("         shouldAssembleShaken\n");
+        sasm.addRoot("THREE");
+        return assembleInto(sasm, "tests/test-shake.fasm");
+    }
+
+    void shouldDropUnreachableWords() {
+        printf("         shouldDropUnreachableWords\n");
+        assertEquals(sasm.getLabelAddress("ONE"), 264, "Called from the root");
+        assertEquals(sasm.getLabelAddress("TWO"), -1, "Dropped");
+        assertEquals(sasm.getLabelAddress("THREE"), 276, "Moves down");
+        assertEquals(sasm.getImageEnd(), 292, "Image ends with the root");
+    }
+
+    void shouldRelinkPastDroppedWords() {
+        printf("         shouldRelinkPastDroppedWords\n");
+        assertEquals(vm->read(sasm.getLabelAddress("THREE") + 8), 264, "Links to ONE");
+        assertEquals(vm->read(sasm.getLabelAddress("ONE") + 6), 0, "End of the chain");
+    }
+
+    void shouldKeepOuterOnlyAsBoot() {
+        printf("         shouldKeepOuterOnlyAsBoot\n");
+        Assembler repl;
+        repl.addRoot("APP");
+        if(assembleInto(repl, "tests/test-boot.fasm")) {
+            assert(repl.getLabelAddress("OUTER") != -1, "BOOT keeps OUTER");
+        }
+        Assembler turnkey;
+        turnkey.addRoot("APP");
+        turnkey.setBoot("APP_WA");
+        if(assembleInto(turnkey, "tests/test-boot.fasm")) {
+            assertEquals(turnkey.getLabelAddress("OUTER"), -1, "OUTER dropped");
+            assertEquals(vm->read(turnkey.getLabelAddress("BOOT")), turnkey.getLabelAddress("APP_WA"), "BOOT runs APP");
+        }
+    }
+};
+#endif
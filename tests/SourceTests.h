@@ -0,0 +1,163 @@
+#ifndef UKMAKER_SOURCETESTS_H
+#define UKMAKER_SOURCETESTS_H
+
+#include <stdlib.h>
+#include <unistd.h>
+#include "Test.h"
+#include "../tools/host_syscalls.h"
+
+#define SOURCE_TEST_NAME 0x2a00
+#define SOURCE_TEST_DP 0x2b00
+#define SOURCE_TEST_SP 0x2dfe
+
+/**
+ * The host sources STREAM_FILE reads, see SourceStream.h, through
+ * syscall_source with %SOURCE passed in and out as *SOURCE does
+ */
+class SourceTests : public Test {
+
+    public:
+    SourceTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    char outer[32];
+    char inner[32];
+    uint16_t depth;
+
+    void run() {
+        strcpy(outer, "/tmp/forth-source-XXXXXX");
+        strcpy(inner, "/tmp/forth-nested-XXXXXX");
+        int fo = mkstemp(outer);
+        int fi = mkstemp(inner);
+        assert(fo >= 0 && fi >= 0, "Should create the test files");
+        if(fo < 0 || fi < 0) {
+            return;
+        }
+        close(fo);
+        close(fi);
+        vm->set(REG_SP, SOURCE_TEST_SP);
+        depth = 0;
+        shouldTokenizeLongLine();
+        shouldNestSources();
+        shouldDropSourcesAfterRestart();
+        unlink(outer);
+        unlink(inner);
+    }
+
+    void writeFile(const char *path, const char *text) {
+        FILE *fp = fopen(path, "w");
+        fputs(text, fp);
+        fclose(fp);
+    }
+
+    // ( ... op depth -- ... depth ) keeping depth as %SOURCE would
+    void source(uint16_t op) {
+        vm->push(op);
+        vm->push(depth);
+        syscall_source(vm);
+        depth = vm->pop();
+    }
+
+    // ( name -- success )
+    bool openSource(const char *path) {
+        uint16_t len = strlen(path);
+        vm->ram()->put(SOURCE_TEST_NAME, len);
+        for(uint16_t i = 0; i < len; i++) {
+            vm->ram()->putC(SOURCE_TEST_NAME + 2 + i, path[i]);
+        }
+        vm->push(SOURCE_TEST_NAME);
+        source(SOURCE_OPEN);
+        return vm->pop() != 0;
+    }
+
+    bool nextLine() {
+        source(SOURCE_LINE);
+        return vm->pop() != 0;
+    }
+
+    // ( sep dp -- len ) the token at SOURCE_TEST_DP is left in text
+    uint16_t token(char *text) {
+        vm->push(' ');
+        vm->push(SOURCE_TEST_DP);
+        source(SOURCE_TOKEN);
+        uint16_t len = vm->pop();
+        text[0] = '\0';
+        if(len > 0) {
+            assertEquals(vm->ram()->get(SOURCE_TEST_DP), len, "Token stored as a string");
+            for(uint16_t i = 0; i < len; i++) {
+                text[i] = vm->ram()->getC(SOURCE_TEST_DP + 2 + i);
+            }
+            text[len] = '\0';
+        }
+        return len;
+    }
+
+    void shouldTokenizeLongLine() {
+        printf("         shouldTokenizeLongLine\n");
+        char text[160];
+        char word[101];
+        memset(word, 'W', 100);
+        word[100] = '\0';
+        snprintf(text, sizeof(text), "  %s BB\r\nCC", word);
+        writeFile(outer, text);
+        assert(openSource(outer), "Should open");
+        assertEquals(depth, 1, "One source");
+        assert(nextLine(), "First line");
+        assertEquals(token(text), 100, "A token longer than the line buffer");
+        assertString(text, word, "The long token");
+        token(text);
+        assertString(text, "BB", "CR is not part of the token");
+        assertEquals(token(text), 0, "End of the line");
+        assert(nextLine(), "Last line has no newline");
+        token(text);
+        assertString(text, "CC", "Last line");
+        assert(!nextLine(), "End of the source");
+        source(SOURCE_CLOSE);
+        assertEquals(depth, 0, "Closed");
+    }
+
+    void shouldNestSources() {
+        printf("         shouldNestSources\n");
+        char text[16];
+        writeFile(outer, "O1 O2\nO3\n");
+        writeFile(inner, "I1\n");
+        openSource(outer);
+        nextLine();
+        token(text);
+        assertString(text, "O1", "Outer token");
+        assert(openSource(inner), "Should open inside");
+        assertEquals(depth, 2, "Nested");
+        nextLine();
+        token(text);
+        assertString(text, "I1", "Inner token");
+        assertEquals(token(text), 0, "End of the inner line");
+        assert(!nextLine(), "End of the inner source");
+        source(SOURCE_CLOSE);
+        assertEquals(depth, 1, "Back to the outer source");
+        token(text);
+        assertString(text, "O2", "Carries on along the outer line");
+        nextLine();
+        token(text);
+        assertString(text, "O3", "Next outer line");
+        source(SOURCE_CLOSE);
+        assertEquals(depth, 0, "Closed");
+    }
+
+    // A restart zeroes %SOURCE with the host sources still open
+    void shouldDropSourcesAfterRestart() {
+        printf("         shouldDropSourcesAfterRestart\n");
+        char text[16];
+        writeFile(outer, "O1\n");
+        openSource(outer);
+        openSource(outer);
+        nextLine();
+        assertEquals(depth, 2, "Two open");
+        depth = 0;
+        assertEquals(token(text), 0, "No token once %SOURCE is 0");
+        assertEquals(depth, 0, "Depth stays 0");
+        assert(host_source() == NULL, "Host sources dropped");
+        assert(openSource(outer), "Should open again");
+        assertEquals(depth, 1, "From the outermost");
+        source(SOURCE_CLOSE);
+    }
+};
+#endif
@@ -0,0 +1,141 @@
+#ifndef UKMAKER_STACKTESTS_H
+#define UKMAKER_STACKTESTS_H
+
+#include "Test.h"
+
+#define STACK_TEST_DS_LIMIT 0x2e00
+#define STACK_TEST_DS_TOP 0x2f00
+#define STACK_TEST_RS_LIMIT 0x2c00
+#define STACK_TEST_RS_TOP 0x2d00
+
+// What the syscall read back through ram() after its push
+uint16_t StackTests_seen;
+
+// ( n -- n*10 7 ) Edits the stack in RAM, then pushes
+void StackTests_syscall(ForthVM *vm) {
+    Memory *mem = vm->ram();
+    uint16_t sp = vm->get(REG_SP);
+    mem->put(sp + 2, mem->get(sp + 2) * 10);
+    vm->push(7);
+    StackTests_seen = vm->ram()->get(sp);
+}
+
+/**
+ * The native stack windows, see NativeStack.h. Memory reads and writes on
+ * a held stack must spill it first and the next push or pop reload it.
+ */
+class StackTests : public Test {
+
+    public:
+    StackTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    void run() {
+#if NATIVE_STACK_CELLS > 0
+        shouldSpillForDirectAccess();
+        shouldSyncAroundSyscall();
+        shouldCrossWindowEdge();
+        shouldTrapPastWindow();
+#endif
+    }
+
+    void setup(ForthVM &svm) {
+        svm.setStackBounds(STACK_TEST_DS_LIMIT, STACK_TEST_DS_TOP, STACK_TEST_RS_LIMIT, STACK_TEST_RS_TOP);
+        svm.setNativeStacks(STACK_TEST_DS_LIMIT, STACK_TEST_DS_TOP, STACK_TEST_RS_LIMIT, STACK_TEST_RS_TOP);
+        svm.reset();
+        svm.set(REG_SP, STACK_TEST_DS_TOP);
+        svm.set(REG_RS, STACK_TEST_RS_TOP);
+    }
+
+    void shouldSpillForDirectAccess() {
+        printf("         shouldSpillForDirectAccess\n");
+        ForthVM svm(vm->ram(), NULL, 0);
+        setup(svm);
+
+        loader->reset();
+        loader->load(0,0,OP_MOVAI, 5);
+        loader->load(0,0,OP_PUSHD, REG_A, 0);
+        loader->load(0,0,OP_PUSHR, REG_A, 0);
+        loader->load(0,0,OP_MOVIL, REG_B, 0);
+        loader->load(STACK_TEST_DS_TOP);
+        loader->load(0,0,OP_LD, REG_0, REG_B); // @ on the held data stack
+        loader->load(0,0,OP_MOVAI, 9);
+        loader->load(0,0,OP_ST, REG_B, REG_A); // ! on it
+        loader->load(0,0,OP_POPD, REG_1, 0);
+        loader->load(0,0,OP_MOVIL, REG_B, 0);
+        loader->load(STACK_TEST_RS_TOP);
+        loader->load(0,0,OP_LD, REG_2, REG_B); // @ on the held return stack
+        loader->load(0,0,OP_HALT,0);
+        svm.run();
+        assertEquals(svm.get(REG_0), 5, "@ should see the pushed cell");
+        assertEquals(svm.get(REG_1), 9, "POPD should see the stored cell");
+        assertEquals(svm.get(REG_2), 5, "@ should see the pushed return cell");
+    }
+
+    void shouldSyncAroundSyscall() {
+        printf("         shouldSyncAroundSyscall\n");
+        Syscall syscalls[1] = { StackTests_syscall };
+        ForthVM svm(vm->ram(), syscalls, 1);
+        setup(svm);
+
+        loader->reset();
+        loader->load(0,0,OP_MOVAI, 3);
+        loader->load(0,0,OP_PUSHD, REG_A, 0);
+        loader->load(0,0,OP_SYSCALL, 0);
+        loader->load(0,0,OP_POPD, REG_0, 0);
+        loader->load(0,0,OP_POPD, REG_1, 0);
+        loader->load(0,0,OP_HALT,0);
+        StackTests_seen = 0;
+        svm.run();
+        assertEquals(StackTests_seen, 7, "ram() should see the syscall's push");
+        assertEquals(svm.get(REG_0), 7, "Should pop the syscall's push");
+        assertEquals(svm.get(REG_1), 30, "Should pop the cell edited in RAM");
+        assertEquals(svm.get(REG_SP), STACK_TEST_DS_TOP, "Should balance");
+    }
+
+    // Cells below the window go straight to RAM
+    void shouldCrossWindowEdge() {
+        printf("         shouldCrossWindowEdge\n");
+        ForthVM svm(vm->ram(), NULL, 0);
+        setup(svm);
+        uint16_t cells = NATIVE_STACK_CELLS + 2;
+        for(uint16_t i = 0; i < cells; i++) {
+            svm.push(i + 1);
+        }
+        uint16_t bottom = STACK_TEST_DS_TOP - ((cells - 1) << 1);
+        assertEquals(svm.read(bottom), cells, "Below the window in RAM");
+        assertEquals(svm.read(STACK_TEST_DS_TOP), 1, "Top of the window spilled");
+        svm.push(cells + 1);
+        bool ordered = true;
+        for(uint16_t i = cells + 1; i > 0; i--) {
+            ordered = ordered && svm.pop() == i;
+        }
+        assert(ordered, "Should pop back across the edge in order");
+        assert(!svm.halted(), "Should not trap");
+    }
+
+    void shouldTrapPastWindow() {
+        printf("         shouldTrapPastWindow\n");
+        ForthVM svm(vm->ram(), NULL, 0);
+        setup(svm);
+        uint16_t cells = ((STACK_TEST_DS_TOP - STACK_TEST_DS_LIMIT) >> 1) + 1;
+        for(uint16_t i = 0; i < cells; i++) {
+            svm.push(i);
+        }
+        assert(!svm.halted(), "The whole region should fit");
+        svm.push(cells);
+        svm.step(); // The trap is taken at the next cycle
+        assert(svm.halted(), "Should trap on overflow");
+        assertEquals(svm.get(REG_SP), STACK_TEST_DS_LIMIT - 2, "SP should stop below the limit");
+        assertEquals(svm.read(STACK_TEST_DS_LIMIT), cells - 1, "Last cell kept");
+
+        setup(svm);
+        svm.push(1);
+        svm.pop();
+        assert(!svm.halted(), "Balanced");
+        svm.pop();
+        svm.step();
+        assert(svm.halted(), "Should trap on underflow");
+        assertEquals(svm.get(REG_SP), STACK_TEST_DS_TOP + 2, "SP past the top");
+    }
+};
+#endif
@@ -32,6 +32,21 @@ class Test {
         assertEquals(fasm->fileSize(), size, "Wrong file size");
     }
 
+    // Assemble file with a test's own assembler and load it into the VM
+    bool assembleInto(Assembler &tasm, const char *file) {
+        bool opened = tasm.slurp(file);
+        assert(opened, "Failed to open file ", file);
+        if(!opened) {
+            return false;
+        }
+        tasm.pass1();
+        tasm.pass2();
+        tasm.pass3();
+        assert(!tasm.hasErrors(), "Should assemble", file);
+        tasm.writeMemory(vm->ram());
+        return true;
+    }
+
 
     void shouldGetAnOpcode(const char *name, uint8_t opcode) {
         printf("         shouldGet%s\n", name);
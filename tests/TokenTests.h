@@ -0,0 +1,51 @@
+#ifndef UKMAKER_TOKENTESTS_H
+#define UKMAKER_TOKENTESTS_H
+
+#include "Test.h"
+
+class TokenTests : public Test {
+
+    public:
+    TokenTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    // A private assembler, #TOKENS must not leak into the core build
+    Assembler tasm;
+
+    void run() {
+        if(!shouldAssembleTokens()) {
+            return;
+        }
+        shouldThreadStraightLineWords();
+        shouldNotThreadRFromWords();
+    }
+
+    bool shouldAssembleTokens() {
+        printf("         shouldAssembleTokens\n");
+        return assembleInto(tasm, "tests/test-tokens.fasm");
+    }
+
+    void shouldThreadStraightLineWords() {
+        printf("         shouldThreadStraightLineWords\n");
+        uint16_t one = tasm.getLabelAddress("ONE_WA");
+        uint16_t end = tasm.getLabelAddress("ONE_END");
+        assertEquals(vm->read(one), tasm.getLabelAddress("TCOLON"), "Code address");
+        assertEquals(vm->ram()->getC(one + 2), THREAD_TOKEN_FIRST, "DUP from the table");
+        assertEquals(vm->ram()->getC(one + 3), THREAD_TOKEN_LIT, "Literal");
+        assertEquals(vm->ram()->getC(one + 4), 7, "Literal value");
+        assertEquals(vm->ram()->getC(one + 6), THREAD_TOKEN_BRANCH0, "*IF");
+        assertEquals(vm->ram()->getC(one + 7), end & 0xff, "Branch address");
+        assertEquals(vm->ram()->getC(one + 9), THREAD_TOKEN_ESCAPE, "DROP escaped");
+        assertEquals(end, one + 12, "Label moves with the tokens");
+        assertEquals(vm->ram()->getC(end), THREAD_TOKEN_EXIT, "Exit");
+        assertEquals(tasm.getLabelAddress("TWO_WA"), end + 2, "Aligned after exit");
+    }
+
+    void shouldNotThreadRFromWords() {
+        printf("         shouldNotThreadRFromWords\n");
+        uint16_t two = tasm.getLabelAddress("TWO_WA");
+        uint16_t three = tasm.getLabelAddress("THREE_WA");
+        assertEquals(vm->read(two), tasm.getLabelAddress("COLON"), "Uses R>");
+        assertEquals(vm->read(three), tasm.getLabelAddress("COLON"), "Calls a word starting with R>");
+    }
+};
+#endif
@@ -0,0 +1,57 @@
+#ifndef UKMAKER_TRAPTESTS_H
+#define UKMAKER_TRAPTESTS_H
+
+#include "Test.h"
+
+class TrapTests : public Test {
+
+    public:
+    TrapTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    void run() {
+        shouldHaltWithoutTrapVector();
+        shouldEnterTrapVector();
+    }
+
+    void shouldHaltWithoutTrapVector() {
+        printf("         shouldHaltWithoutTrapVector\n");
+        ForthVM tvm(vm->ram(), NULL, 0);
+        tvm.setStackBounds(0x2e00, 0x2f00, 0x2c00, 0x2d00);
+
+        loader->reset();
+        loader->load(0,0,OP_MOVIL, REG_SP, 0);
+        loader->load(0x2f00);
+        loader->load(0,0,OP_POPD, REG_A, 0); // Underflow
+        loader->load(0,0,OP_MOVAI, 7);
+        loader->load(0,0,OP_HALT,0);
+        tvm.reset();
+        tvm.run();
+        assert(tvm.halted(), "Should halt");
+        assertEquals(tvm.get(REG_PC), 6, "Should stop after the faulting instruction");
+        assertEquals(tvm.get(REG_A), 0, "Should not run the next instruction");
+    }
+
+    void shouldEnterTrapVector() {
+        printf("         shouldEnterTrapVector\n");
+        ForthVM tvm(vm->ram(), NULL, 0);
+        tvm.setStackBounds(0x2f00, 0x2f00, 0x2c00, 0x2d00);
+        tvm.setStackTrap(12);
+
+        loader->reset();
+        loader->load(0,0,OP_MOVIL, REG_SP, 0);
+        loader->load(0x2f00);
+        loader->load(0,0,OP_PUSHD, REG_A, 0);
+        loader->load(0,0,OP_PUSHD, REG_A, 0); // Overflow
+        loader->load(0,0,OP_MOVAI, 7);
+        loader->load(0,0,OP_HALT,0);
+        loader->load(0,0,OP_POPD, REG_B, 0); // Trap vector at 12
+        loader->load(0,0,OP_HALT,0);
+        tvm.reset();
+        tvm.set(REG_A, 0);
+        tvm.run();
+        assertEquals(tvm.get(REG_B), STACK_TRAP_DS_OVERFLOW, "Should push the trap number");
+        assertEquals(tvm.get(REG_A), 0, "Should not run the next instruction");
+        assertEquals(tvm.get(REG_PC), 16, "Should halt in the trap code");
+    }
+};
+#endif
@@ -0,0 +1,90 @@
+#ifndef UKMAKER_WATCHTESTS_H
+#define UKMAKER_WATCHTESTS_H
+
+#include "Test.h"
+#include "../tools/WatchMemory.h"
+
+class WatchTests : public Test {
+
+    public:
+    WatchTests(TestSuite *suite, ForthVM *fvm, Assembler *vmasm, Loader *loader) : Test(suite, fvm, vmasm, loader) {}
+
+    void run() {
+        shouldTrapWordStore();
+        shouldTrapOverlappingByteStore();
+        shouldIgnoreUnwatchedStore();
+        shouldHaltRunOnHit();
+    }
+
+    void shouldTrapWordStore() {
+        printf("         shouldTrapWordStore\n");
+        WatchMemory watch(vm->ram());
+        ForthVM wvm(&watch, NULL, 0);
+        vm->ram()->put(0x100, 0x1234);
+        watch.watch(0x100, 0x102);
+
+        loader->reset();
+        loader->load(0,0,OP_MOVIL, REG_0, 0);
+        loader->load(0x100);
+        loader->load(0,0,OP_MOVAI, 5);
+        loader->load(0,0,OP_ST, REG_0, REG_A);
+        loader->load(0,0,OP_HALT,0);
+        wvm.reset();
+        wvm.step();
+        wvm.step();
+        assert(!watch.hit(), "Should not trap before the store");
+        wvm.step();
+        assert(watch.hit(), "Should trap the store");
+        assertEquals(watch.hitAddress(), 0x100, "Address");
+        assertEquals(watch.hitOldValue(), 0x1234, "Old value");
+        assertEquals(watch.hitNewValue(), 5, "New value");
+    }
+
+    void shouldTrapOverlappingByteStore() {
+        printf("         shouldTrapOverlappingByteStore\n");
+        WatchMemory watch(vm->ram());
+        watch.watch(0x141, 0x142);
+        watch.putC(0x140, 1);
+        assert(!watch.hit(), "Should not trap the byte below");
+        watch.put(0x140, 0x0202);
+        assert(watch.hit(), "Should trap a word covering the watch");
+    }
+
+    void shouldIgnoreUnwatchedStore() {
+        printf("         shouldIgnoreUnwatchedStore\n");
+        WatchMemory watch(vm->ram());
+        watch.watch(0x100, 0x102);
+        watch.put(0x102, 7);
+        watch.put(0x0fe, 7);
+        assert(!watch.hit(), "Should ignore neighbouring stores");
+        watch.unwatch(0x100);
+        watch.put(0x100, 7);
+        assert(!watch.hit(), "Should ignore removed watches");
+    }
+
+    void shouldHaltRunOnHit() {
+        printf("         shouldHaltRunOnHit\n");
+        WatchMemory watch(vm->ram());
+        ForthVM wvm(&watch, NULL, 0);
+        watch.haltOnHit(&wvm);
+        vm->ram()->put(0x100, 0x1234);
+        watch.watch(0x100, 0x102);
+
+        loader->reset();
+        loader->load(0,0,OP_MOVIL, REG_0, 0);
+        loader->load(0x100);
+        loader->load(0,0,OP_MOVAI, 5);
+        loader->load(0,0,OP_ST, REG_0, REG_A);
+        loader->load(0,0,OP_MOVAI, 7);
+        loader->load(0,0,OP_HALT,0);
+        wvm.reset();
+        wvm.run();
+        assert(watch.hit(), "Should stop run() on the store");
+        assertEquals(wvm.get(REG_A), 5, "Should halt before the next instruction");
+        assertEquals(watch.hitAddress(), 0x100, "Address");
+        assertEquals(watch.hitOldValue(), 0x1234, "Old value");
+        assertEquals(watch.hitNewValue(), 5, "New value");
+        assertEquals(watch.hitPC(), 8, "PC past the store");
+    }
+};
+#endif
@@ -0,0 +1,41 @@
+#ifndef UKMAKER_TEST_NATIVE_H
+#define UKMAKER_TEST_NATIVE_H
+// Generated by Dumper::writeNative, include after ForthVM.h
+struct TestImage;
+template<> struct ForthNative<TestImage> {
+    // START
+    static uint16_t f_0100(ForthVM *vm) {
+        (void)vm;
+        vm->_regs[REG_SP] = 0x2f00;
+        vm->_regs[REG_RS] = 0x2e00;
+        vm->_regs[REG_A] = 0x0000;
+        vm->_regs[REG_B] = 0x000a;
+        vm->_pushd(vm->_regs[REG_B]);
+        if(vm->_halted) return 0x0112;
+        vm->_pushr(0x0116);
+        return 0x011c;
+    }
+    // LOOP
+    static uint16_t f_0110(ForthVM *vm) {
+        (void)vm;
+        vm->_pushd(vm->_regs[REG_B]);
+        if(vm->_halted) return 0x0112;
+        vm->_pushr(0x0116);
+        return 0x011c;
+    }
+    // ADDTOP
+    static uint16_t f_011c(ForthVM *vm) {
+        (void)vm;
+        vm->_regs[REG_0] = vm->_popd();
+        if(vm->_halted) return 0x011e;
+        vm->_add(REG_A, REG_0);
+        return vm->_popr();
+    }
+};
+#define TEST_NATIVE_COUNT 3
+const NativeEntry testNative[TEST_NATIVE_COUNT] = {
+    { 0x0100, ForthNative<TestImage>::f_0100 },
+    { 0x0110, ForthNative<TestImage>::f_0110 },
+    { 0x011c, ForthNative<TestImage>::f_011c },
+};
+#endif // UKMAKER_TEST_NATIVE_H
@@ -82,6 +82,24 @@ public:
         }
     }
 
+    /**
+     * Keep the word at this label when tree shaking, see shake()
+     */
+    void addRoot(const char *name) {
+        Option *root = new Option(name, 0);
+        root->next = roots;
+        roots = root;
+    }
+
+    /**
+     * Have START run the word at this word address label instead of OUTER,
+     * by pointing the BOOT cell at it. Shaking then drops OUTER unless the
+     * word or a root still uses it
+     */
+    void setBoot(const char *name) {
+        boot = name;
+    }
+
     Option  *getOption(const char *name) {
         if(options == NULL) return NULL;
         Option *opt = options;
@@ -107,6 +125,42 @@ public:
         return -1;
     }
 
+    int getConstant(const char *name)
+    {
+        Token *tok = tokens;
+        while (tok != NULL)
+        {
+            if (tok->isConst() && tok->name != NULL && (strcmp(tok->name, name) == 0))
+            {
+                return tok->value;
+            }
+            tok = tok->next;
+        }
+        return -1;
+    }
+
+    // First address after the last variable
+    int getVariablesEnd()
+    {
+        int end = -1;
+        Token *tok = tokens;
+        while (tok != NULL)
+        {
+            if (tok->isVar() && (tok->address + tok->value) > end)
+            {
+                end = tok->address + tok->value;
+            }
+            tok = tok->next;
+        }
+        return end;
+    }
+
+    // First address after the code, strings and headers, set by pass2
+    int getImageEnd()
+    {
+        return imageEnd;
+    }
+
     Token *getOpcode(uint16_t addr)
     {
         Token *tok = tokens;
@@ -231,6 +285,532 @@ public:
             tok->next = getToken();
             tok = tok->next;
         }
+
+        if (!phase1Error && boot != NULL)
+        {
+            patchBoot();
+        }
+        if (!phase1Error && roots != NULL)
+        {
+            shake();
+        }
+        if (!phase1Error && getConstant("#TOKENS") > 0)
+        {
+            threadTokens();
+        }
+        if (!phase1Error && getConstant("#HEADERS") > 0)
+        {
+            separateHeaders();
+        }
+    }
+
+    /**
+     * Drop the words which can't be reached from START or the roots
+     *
+     * The tokens are cut into segments at each word and after any
+     * unconditional jump or SEMI, so a segment is only ever entered by
+     * name. Everything before the first word is the inner interpreter and
+     * always kept. Any reference from a kept segment keeps the segment
+     * holding its label, apart from the dictionary links, which are then
+     * pointed past the dropped words. Later .ORGs go too so the image
+     * ends with the last kept word.
+     */
+    void shake()
+    {
+        uint16_t segments = segmentTokens();
+        bool *kept = (bool *)calloc(segments + 1, sizeof(bool));
+        uint16_t firstWord = keepBoot(kept, segments);
+        for (Option *root = roots; root != NULL; root = root->next)
+        {
+            Token *label = findNamedToken(root->name);
+            if (label == NULL)
+            {
+                printf("ERROR: root %s is not a label\n", root->name);
+                phase1Error = true;
+            }
+            else
+            {
+                kept[label->segment] = true;
+            }
+        }
+
+        keepReferenced(kept);
+
+        Token *tok;
+        int words = 0;
+        int keptWords = 0;
+        for (tok = tokens; tok != NULL; tok = tok->next)
+        {
+            if (tok->isDirective() && tok->isHeader())
+            {
+                words++;
+                if (kept[tok->segment])
+                {
+                    keptWords++;
+                    relink(nextCode(tok), kept);
+                }
+            }
+        }
+        for (tok = tokens; tok != NULL; tok = tok->next)
+        {
+            bool dropped = !kept[tok->segment] && tok->type != TOKEN_TYPE_CONST
+                && tok->type != TOKEN_TYPE_VAR && !tok->isOrg();
+            if (dropped || (tok->isOrg() && tok->segment >= firstWord))
+            {
+                tok->type = TOKEN_TYPE_COMMENT;
+            }
+        }
+        fprintf(stderr, "Tree shaking kept %d of %d words\n", keptWords, words);
+        free(kept);
+    }
+
+    /**
+     * Whether the code at label can be run from START, following the same
+     * references as shake(). The dictionary links don't count
+     */
+    bool reaches(const char *name)
+    {
+        Token *label = findNamedToken(name);
+        if (label == NULL)
+        {
+            return false;
+        }
+        uint16_t segments = segmentTokens();
+        bool *kept = (bool *)calloc(segments + 1, sizeof(bool));
+        keepBoot(kept, segments);
+        keepReferenced(kept);
+        bool reached = kept[label->segment];
+        free(kept);
+        return reached;
+    }
+
+    // Point the BOOT cell at the word given to setBoot()
+    void patchBoot()
+    {
+        Token *label = findLabelToken("BOOT");
+        Token *cell = label == NULL ? NULL : nextCode(label);
+        if (cell == NULL || !cell->isData() || !cell->symbolic)
+        {
+            printf("ERROR: no BOOT cell to point at %s\n", boot);
+            phase1Error = true;
+            return;
+        }
+        cell->str = boot;
+    }
+
+    // Keep everything before the first word, returning that word's segment
+    uint16_t keepBoot(bool *kept, uint16_t segments)
+    {
+        Token *tok = tokens;
+        while (tok != NULL && !(tok->isDirective() && tok->isHeader()))
+        {
+            tok = tok->next;
+        }
+        uint16_t firstWord = tok == NULL ? segments + 1 : tok->segment;
+        for (uint16_t segment = 0; segment < firstWord; segment++)
+        {
+            kept[segment] = true;
+        }
+        return firstWord;
+    }
+
+    // Follow the references from kept segments until nothing new is kept
+    void keepReferenced(bool *kept)
+    {
+        bool more = true;
+        while (more)
+        {
+            more = false;
+            Token *previous = NULL;
+            for (Token *tok = tokens; tok != NULL; tok = tok->next)
+            {
+                if (tok->type == TOKEN_TYPE_COMMENT)
+                {
+                    continue;
+                }
+                bool link = previous != NULL && previous->isDirective() && previous->isHeader();
+                previous = tok;
+                if (!kept[tok->segment] || !tok->symbolic || tok->str == NULL || link)
+                {
+                    continue;
+                }
+                Token *label = findNamedToken(tok->str);
+                if (label != NULL && !kept[label->segment])
+                {
+                    kept[label->segment] = true;
+                    more = true;
+                }
+            }
+        }
+    }
+
+    // Number the segments for shake(), returning the last one
+    uint16_t segmentTokens()
+    {
+        uint16_t segment = 0;
+        bool split = true;
+        Token *last = NULL;
+        for (Token *tok = tokens; tok != NULL; tok = tok->next)
+        {
+            if (tok->type == TOKEN_TYPE_COMMENT)
+            {
+                tok->segment = segment;
+                continue;
+            }
+            bool startsRun = (tok->isLabel() || (tok->isDirective() && tok->isHeader()))
+                && (last == NULL || !last->isLabel());
+            if (tok->isOrg() || (startsRun && (split || startsWord(tok))))
+            {
+                segment++;
+            }
+            tok->segment = segment;
+            if (!tok->isLabel())
+            {
+                split = endsFlow(tok, last);
+            }
+            last = tok;
+        }
+        return segment;
+    }
+
+    // Whether the run of labels at tok leads to a word header
+    bool startsWord(Token *tok)
+    {
+        while (tok != NULL && (tok->isLabel() || tok->type == TOKEN_TYPE_COMMENT))
+        {
+            tok = tok->next;
+        }
+        return tok != NULL && tok->isDirective() && tok->isHeader();
+    }
+
+    // Whether execution can't fall through from tok to what follows
+    bool endsFlow(Token *tok, Token *previous)
+    {
+        if (tok->isCode() && !tok->isConditional())
+        {
+            return tok->opcode == OP_JP || tok->opcode == OP_JR || tok->opcode == OP_JX
+                || tok->opcode == OP_JXL || tok->opcode == OP_RET
+                || (tok->opcode == OP_MOV && tok->arga == REG_PC);
+        }
+        return isSymbolData(tok, "SEMI")
+            && (previous == NULL || operandToken(previous) == THREAD_TOKEN_EXIT);
+    }
+
+    // The label or named string called name, NULL for anything else
+    Token *findNamedToken(const char *name)
+    {
+        Symbol *sym = getSymbol(name);
+        if (sym->token == NULL || !(sym->token->isLabel() || sym->token->type == TOKEN_TYPE_STR))
+        {
+            return NULL;
+        }
+        return sym->token;
+    }
+
+    // Point the link past any dropped words, following the original chain
+    void relink(Token *link, bool *kept)
+    {
+        while (link != NULL && link->isData() && link->symbolic)
+        {
+            Token *label = findNamedToken(link->str);
+            if (label == NULL || kept[label->segment])
+            {
+                return;
+            }
+            Token *header = label;
+            while (header != NULL && !(header->isDirective() && header->isHeader()))
+            {
+                header = nextCode(header);
+            }
+            Token *next = header == NULL ? NULL : nextCode(header);
+            if (next == NULL || !next->isData())
+            {
+                break;
+            }
+            link->symbolic = next->symbolic;
+            link->str = next->str;
+            link->value = next->value;
+        }
+        if (link != NULL && link->isData() && link->symbolic)
+        {
+            link->symbolic = false;
+            link->value = 0;
+        }
+    }
+
+    /**
+     * Move the word headers out to their own region starting at #HEADERS
+     *
+     * The labels before a header, the header and its link are marked for
+     * the header region and followed by a pointer to the code field, which
+     * stays where it was. The runtime sees HEADER_SEPARATE_BIT and follows
+     * the pointer, so the code cells end up contiguous and the headers can
+     * be left out of a turnkey image.
+     */
+    void separateHeaders()
+    {
+        int count = 0;
+        Token *first = NULL;
+        for (Token *tok = tokens; tok != NULL; tok = tok->next)
+        {
+            if (tok->isLabel())
+            {
+                if (first == NULL)
+                {
+                    first = tok;
+                }
+                continue;
+            }
+            if (tok->type == TOKEN_TYPE_COMMENT)
+            {
+                continue;
+            }
+            Token *link = nextCode(tok);
+            if (tok->isDirective() && tok->isHeader() && link != NULL && link->isData())
+            {
+                Token *pointer = codePointer(link, count++);
+                for (Token *t = first == NULL ? tok : first; t != pointer->next; t = t->next)
+                {
+                    t->header = true;
+                }
+                tok = pointer;
+            }
+            first = NULL;
+        }
+    }
+
+    // Insert a .DATA after the link pointing at the code field, labelling it if need be
+    Token *codePointer(Token *link, int count)
+    {
+        Token *cf = nextCode(link);
+        if (cf == NULL || !cf->isLabel())
+        {
+            char *name = (char *)malloc(24);
+            snprintf(name, 24, "HEADER_CODE_%d", count);
+            cf = new Token(name, link->line, link->pos);
+            cf->type = TOKEN_TYPE_LABEL;
+            cf->next = link->next;
+            link->next = cf;
+            getSymbol(name)->token = cf;
+        }
+        Token *pointer = new Token(NULL, link->line, link->pos);
+        pointer->type = TOKEN_TYPE_DIRECTIVE;
+        pointer->opcode = DIRECTIVE_TYPE_DATA;
+        pointer->symbolic = true;
+        pointer->str = cf->name;
+        pointer->next = link->next;
+        link->next = pointer;
+        return pointer;
+    }
+
+    /**
+     * Rewrite colon words as token-threaded TCOLON words
+     *
+     * A body qualifies if it is only .DATA up to the first SEMI, branches
+     * only with *IF, *ELSE and *UNTIL to labels inside it, has no label
+     * used from outside and calls nothing else from INLINE_REJECT nor any
+     * colon word starting with R>; those all work on the thread or the
+     * return stack. Words in TOKEN_TABLE become one byte, the rest an
+     * escape and the WA.
+     */
+    void threadTokens()
+    {
+        Token *table = findLabelToken("TOKEN_TABLE");
+        Token *reject = findLabelToken("INLINE_REJECT");
+        Token *tok = tokens;
+        while (tok != NULL)
+        {
+            if (tok->isLabel() && isSymbolData(nextCode(tok), "COLON")
+                && tokenThreadable(nextCode(tok), reject))
+            {
+                Token *cf = nextCode(tok);
+                cf->str = "TCOLON";
+                Token *t = nextCode(cf);
+                while (!isSymbolData(t, "SEMI"))
+                {
+                    if (t->isLabel())
+                    {
+                        t = nextCode(t);
+                        continue;
+                    }
+                    uint8_t code = operandToken(t);
+                    if (code != THREAD_TOKEN_EXIT)
+                    {
+                        // the literal or branch address moves into the token
+                        Token *n = nextCode(t);
+                        t->arga = code;
+                        t->symbolic = n->symbolic;
+                        t->str = n->str;
+                        t->value = n->value;
+                        n->type = TOKEN_TYPE_COMMENT;
+                    }
+                    else
+                    {
+                        int index = tableIndex(table, t->str);
+                        t->arga = index == -1 ? THREAD_TOKEN_ESCAPE : THREAD_TOKEN_FIRST + index;
+                    }
+                    t->opcode = DIRECTIVE_TYPE_TOKEN;
+                    t = nextCode(t);
+                }
+                t->opcode = DIRECTIVE_TYPE_TOKEN;
+                t->arga = THREAD_TOKEN_EXIT;
+                t->symbolic = false;
+                tok = t;
+            }
+            tok = tok->next;
+        }
+    }
+
+    // The token for a word followed by an operand cell, else THREAD_TOKEN_EXIT
+    uint8_t operandToken(Token *tok)
+    {
+        if (isSymbolData(tok, "STAR_HASH_WA"))
+            return THREAD_TOKEN_LIT;
+        if (isSymbolData(tok, "STAR_ELSE_WA"))
+            return THREAD_TOKEN_BRANCH;
+        if (isSymbolData(tok, "STAR_IF_WA") || isSymbolData(tok, "STAR_UNTIL_WA"))
+            return THREAD_TOKEN_BRANCH0;
+        return THREAD_TOKEN_EXIT;
+    }
+
+    Token *findLabelToken(const char *name)
+    {
+        Symbol *sym = getSymbol(name);
+        if (sym->token == NULL || !sym->token->isLabel())
+        {
+            return NULL;
+        }
+        return sym->token;
+    }
+
+    // The next token which is not a comment
+    Token *nextCode(Token *tok)
+    {
+        do
+        {
+            tok = tok->next;
+        } while (tok != NULL && tok->type == TOKEN_TYPE_COMMENT);
+        return tok;
+    }
+
+    bool isSymbolData(Token *tok, const char *name)
+    {
+        return tok != NULL && tok->isData() && tok->symbolic && strcmp(tok->str, name) == 0;
+    }
+
+    // Position of name in a .DATA list ending with a number, -1 if absent
+    int tableIndex(Token *list, const char *name)
+    {
+        int index = 0;
+        Token *t = list == NULL ? NULL : nextCode(list);
+        while (t != NULL && t->isData() && t->symbolic)
+        {
+            if (strcmp(t->str, name) == 0)
+            {
+                return index;
+            }
+            index++;
+            t = nextCode(t);
+        }
+        return -1;
+    }
+
+    // Whether any token outside first..last refers to name
+    bool isReferencedOutside(const char *name, Token *first, Token *last)
+    {
+        bool inside = false;
+        for (Token *t = tokens; t != NULL; t = t->next)
+        {
+            if (t == first)
+            {
+                inside = true;
+            }
+            if (!inside && t->symbolic && t->str != NULL && strcmp(t->str, name) == 0)
+            {
+                return true;
+            }
+            if (t == last)
+            {
+                inside = false;
+            }
+        }
+        return false;
+    }
+
+    bool isLabelBetween(const char *name, Token *first, Token *last)
+    {
+        for (Token *t = first; t != NULL; t = t->next)
+        {
+            if (t->isLabel() && strcmp(t->name, name) == 0)
+            {
+                return true;
+            }
+            if (t == last)
+            {
+                break;
+            }
+        }
+        return false;
+    }
+
+    bool startsWithRFrom(const char *name)
+    {
+        Token *t = findLabelToken(name);
+        if (t == NULL || !isSymbolData(nextCode(t), "COLON"))
+        {
+            return false;
+        }
+        t = nextCode(nextCode(t));
+        if (t != NULL && t->isLabel())
+        {
+            t = nextCode(t);
+        }
+        return isSymbolData(t, "RFROM_WA");
+    }
+
+    bool tokenThreadable(Token *cf, Token *reject)
+    {
+        Token *first = nextCode(cf);
+        Token *last = first;
+        while (!isSymbolData(last, "SEMI"))
+        {
+            if (last == NULL || last->type == TOKEN_TYPE_EOF)
+            {
+                return false;
+            }
+            last = nextCode(last);
+        }
+        for (Token *t = first; t != last; t = nextCode(t))
+        {
+            if (t->isLabel())
+            {
+                if (isReferencedOutside(t->name, first, last))
+                {
+                    return false;
+                }
+                continue;
+            }
+            if (!t->isData() || !t->symbolic)
+            {
+                return false;
+            }
+            uint8_t code = operandToken(t);
+            if (code != THREAD_TOKEN_EXIT)
+            {
+                t = nextCode(t);
+                if (t == last || !t->isData()
+                    || (code != THREAD_TOKEN_LIT
+                        && (!t->symbolic || !isLabelBetween(t->str, first, last))))
+                {
+                    return false;
+                }
+            }
+            else if (tableIndex(reject, t->str) != -1 || startsWithRFrom(t->str))
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
     /**
@@ -239,11 +819,22 @@ public:
     void pass2()
     {
         uint16_t addr = 0; // no .org or anything yet. All code starts at address zero
+        uint16_t haddr = getConstant("#HEADERS"); // and separated headers from here
+        bool inHeaders = false;
+        imageEnd = 0;
         Token *tok = tokens;
         Token *label = firstLabel();
         Symbol *sym;
         while (tok != NULL)
         {
+            if (tok->header != inHeaders)
+            {
+                // switch between the code and header regions
+                uint16_t other = haddr;
+                haddr = addr;
+                addr = other;
+                inHeaders = tok->header;
+            }
             switch (tok->type)
             {
             case TOKEN_TYPE_COMMENT:
@@ -280,6 +871,18 @@ public:
                     }
                     addr += 2;
                 }
+                else if (tok->isThreadToken())
+                {
+                    tok->address = addr;
+                    if (label != NULL && tok->address == label->address)
+                    {
+                        tok->label = label;
+                        label = nextLabel();
+                    }
+                    addr += tok->threadTokenSize();
+                    if (tok->arga == THREAD_TOKEN_EXIT && (addr & 1))
+                        addr++; // align to word boundaries
+                }
                 else if (tok->isPStringData())
                 {
                     // Must be a string
@@ -379,8 +982,33 @@ public:
                 break;
             }
 
+            if ((tok->isCode() || tok->type == TOKEN_TYPE_STR
+                || (tok->isDirective() && !tok->isOrg() && !tok->isAlias())) && addr > imageEnd)
+            {
+                imageEnd = addr;
+            }
             tok = tok->next;
         }
+        if (getConstant("#HEADERS") > 0)
+        {
+            checkHeaders(getConstant("#HEADERS"), inHeaders ? addr : haddr);
+        }
+    }
+
+    // The code must stay clear of the header region from start up to end
+    void checkHeaders(uint16_t start, uint16_t end)
+    {
+        for (Token *tok = tokens; tok != NULL; tok = tok->next)
+        {
+            if (!tok->header && tok->address >= start && tok->address < end
+                && (tok->isCode() || tok->isData() || tok->isThreadToken() || tok->isPStringData()))
+            {
+                printf("ERROR: code at %04x overlaps the headers at %04x-%04x, line %d\n",
+                       tok->address, start, end, tok->line);
+                phase2Error = true;
+                return;
+            }
+        }
     }
 
     /**
@@ -488,6 +1116,9 @@ public:
 
     uint16_t headerWord(Token *tok) {
         int r = (1 << HEADER_HEADER_BIT);
+        if(tok->header) {
+            r |= (1 << HEADER_SEPARATE_BIT);
+        }
         if(tok->isHeader()) {
             switch(tok->opcode) {
                 case DIRECTIVE_TYPE_NWORD_STRING:
@@ -533,6 +1164,17 @@ public:
                     printf("%04x %02x %02x\n", tok->address, (tok->value & 0xff00) >> 8, tok->value & 0xff);
                     break;
 
+                case DIRECTIVE_TYPE_TOKEN:
+                    if (tok->threadTokenSize() == 1)
+                    {
+                        printf("%04x %02x\n", tok->address, tok->arga);
+                    }
+                    else
+                    {
+                        printf("%04x %02x %02x %02x\n", tok->address, tok->arga, tok->value & 0xff, (tok->value & 0xff00) >> 8);
+                    }
+                    break;
+
                 case DIRECTIVE_TYPE_PLAIN_STRING:
                 {
                     c = tok->str;
@@ -647,6 +1289,15 @@ public:
                     ram->put(tok->address, tok->value);
                     break;
 
+                case DIRECTIVE_TYPE_TOKEN:
+                    ram->putC(tok->address, tok->arga);
+                    if (tok->threadTokenSize() == 3)
+                    {
+                        ram->putC(tok->address + 1, tok->value & 0xff);
+                        ram->putC(tok->address + 2, (tok->value & 0xff00) >> 8);
+                    }
+                    break;
+
                 case DIRECTIVE_TYPE_PLAIN_STRING:
                 {
                     c = tok->str;
@@ -738,7 +1389,7 @@ public:
 
         Symbol *sym;
 
-        if (tok->isData())
+        if (tok->isData() || tok->isThreadToken())
         {
             // constants are put in-place
             // references to strings or vars are the address
@@ -1352,7 +2003,7 @@ public:
             instructionRI4(tok);
             break;
         case OP_CALLXL:
-            instructionRI4(tok);
+            instructionRI(tok);
             break;
         case OP_CLR:
             instructionRR(tok);
@@ -2452,6 +3103,9 @@ public:
     Token *currentLabel = NULL;
     Symbol *symbols = NULL;
     Option *options = NULL;
+    Option *roots = NULL;
+    const char *boot = NULL;
+    int imageEnd = 0;
     AssemblyVocabulary vocab;
     bool phase1Error;
     bool phase2Error;
@@ -0,0 +1,104 @@
+#ifndef UKMAKER_BATCH_RUNNER_H
+#define UKMAKER_BATCH_RUNNER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "HeadlessRunner.h"
+
+/**
+ * Headless execution of a Forth script on the host.
+ *
+ * The script is read whole, from a file or stdin, in large blocks and
+ * TOKEN reads it a line at a time from memory, see HeadlessRunner.h.
+ * The newline the outer loop prints before each prompt is kept, except
+ * the first, so the output of each line ends with one.
+ *
+ * The run stops after the first error and run() returns false. End of the
+ * script, or the script halting the VM itself, is success.
+ *
+ * stdout should be fully buffered, BATCH_BLOCK at a time, before anything
+ * is written to it: setvbuf can't be used once there has been output.
+ */
+
+#define BATCH_BLOCK 65536
+
+class BatchRunner : public HeadlessRunner {
+
+    public:
+
+    BatchRunner(Assembler *fasm, ForthVM *vm) : HeadlessRunner(fasm, vm) {}
+    ~BatchRunner() {
+        free(_text);
+    }
+
+    /**
+     * Read the script, "-" for stdin, @return false if it can't be read
+     */
+    bool load(const char *path) {
+        _path = path;
+        FILE *fp = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+        if(fp == NULL) {
+            fprintf(stderr, "%s: cannot open\n", path);
+            return false;
+        }
+        size_t size = 0;
+        size_t n;
+        do {
+            _text = (char *)realloc(_text, size + BATCH_BLOCK);
+            n = fread(_text + size, 1, BATCH_BLOCK, fp);
+            size += n;
+        } while(n == BATCH_BLOCK);
+        bool ok = !ferror(fp);
+        if(fp != stdin) {
+            fclose(fp);
+        }
+        if(!ok) {
+            fprintf(stderr, "%s: read error\n", path);
+        }
+        _size = size;
+        return ok;
+    }
+
+    /**
+     * Run the loaded script, @return false if it raised an error
+     */
+    bool run() {
+        _pos = 0;
+
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        runLines();
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        fflush(stdout);
+
+        double ms = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+        fprintf(stderr, "%s: %d lines in %.3f ms%s\n", _path, _line, ms, _errors > 0 ? ", failed" : "");
+        return _errors == 0;
+    }
+
+    protected:
+
+    const char *_path = "-";
+    char *_text = NULL;
+    size_t _size = 0;
+    size_t _pos = 0;
+
+    bool nextLine(const char **line, size_t *len) {
+        if(_errors > 0 || _pos >= _size) {
+            return false;
+        }
+        *line = _text + _pos;
+        const char *nl = (const char *)memchr(*line, '\n', _size - _pos);
+        *len = nl == NULL ? _size - _pos : nl - *line;
+        _pos += *len + 1;
+        _line++;
+        return true;
+    }
+
+    const char *path() {
+        return _path;
+    }
+};
+#endif
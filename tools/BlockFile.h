@@ -0,0 +1,95 @@
+#ifndef UKMAKER_BLOCK_FILE_H
+#define UKMAKER_BLOCK_FILE_H
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../runtime/ArduForth/Blocks.h"
+
+/**
+ * BLOCK storage in a host file, mapped into memory so that reading or
+ * writing back a block is a memcpy. A new or short file is extended to
+ * the number of blocks asked for; a longer one keeps all its blocks.
+ */
+
+class BlockFile : public BlockStorage {
+
+    public:
+
+    BlockFile() : _map(NULL), _blocks(0), _fd(-1) {}
+    ~BlockFile() {
+        close();
+    }
+
+    bool open(const char *path, uint16_t blocks) {
+        close();
+        _fd = ::open(path, O_RDWR | O_CREAT, 0644);
+        if(_fd < 0) {
+            fprintf(stderr, "%s: cannot open\n", path);
+            return false;
+        }
+        struct stat st;
+        if(fstat(_fd, &st) == 0 && st.st_size / BLOCK_SIZE > blocks) {
+            blocks = st.st_size / BLOCK_SIZE > 0xfffe ? 0xfffe : st.st_size / BLOCK_SIZE;
+        }
+        size_t size = (size_t)blocks * BLOCK_SIZE;
+        if(st.st_size < (off_t)size && ftruncate(_fd, size) != 0) {
+            fprintf(stderr, "%s: cannot extend to %u blocks\n", path, blocks);
+            close();
+            return false;
+        }
+        void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+        if(map == MAP_FAILED) {
+            fprintf(stderr, "%s: cannot map\n", path);
+            close();
+            return false;
+        }
+        _map = (uint8_t *)map;
+        _blocks = blocks;
+        return true;
+    }
+
+    void close() {
+        if(_map != NULL) {
+            msync(_map, (size_t)_blocks * BLOCK_SIZE, MS_SYNC);
+            munmap(_map, (size_t)_blocks * BLOCK_SIZE);
+            _map = NULL;
+        }
+        if(_fd >= 0) {
+            ::close(_fd);
+            _fd = -1;
+        }
+        _blocks = 0;
+    }
+
+    uint16_t blocks() {
+        return _blocks;
+    }
+
+    bool read(uint16_t block, uint16_t offset, uint8_t *buf, uint16_t len) {
+        memcpy(buf, _map + (size_t)block * BLOCK_SIZE + offset, len);
+        return true;
+    }
+
+    bool write(uint16_t block, uint16_t offset, const uint8_t *buf, uint16_t len) {
+        memcpy(_map + (size_t)block * BLOCK_SIZE + offset, buf, len);
+        return true;
+    }
+
+    void sync() {
+        if(_map == NULL) {
+            return;
+        }
+        msync(_map, (size_t)_blocks * BLOCK_SIZE, MS_ASYNC);
+    }
+
+    protected:
+
+    uint8_t *_map;
+    uint16_t _blocks;
+    int _fd;
+};
+#endif
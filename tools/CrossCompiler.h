@@ -0,0 +1,127 @@
+#ifndef UKMAKER_CROSS_COMPILER_H
+#define UKMAKER_CROSS_COMPILER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HeadlessRunner.h"
+
+/**
+ * Batch compilation of Forth source into the ROM image.
+ *
+ * The assembled core is booted as usual, then TOKEN reads the lines of
+ * each file in turn instead of the console, see HeadlessRunner.h. Once
+ * the VM first asks for input the dictionary pointer is moved from RAM to
+ * ROM_END, so the new words are compiled straight into the free ROM below
+ * #FENCE (or below #HEADERS when the headers follow the code) and need no
+ * relocation.
+ * At the end CORE_PATCH_LOCATION is pointed at the last word, as
+ * WRITE-CPP does, and the memory can be dumped as a normal image.
+ *
+ * The words are laid out as the compiler does in RAM, with inline
+ * headers. Anything that writes to its own body, e.g. a CREATE buffer,
+ * ends up in flash on the device.
+ */
+
+class CrossCompiler : public HeadlessRunner {
+
+    public:
+
+    CrossCompiler(Assembler *fasm, ForthVM *vm) : HeadlessRunner(fasm, vm) {}
+    ~CrossCompiler() {
+        free(_buf);
+    }
+
+    /**
+     * Compile the files in order, @return false on any error
+     */
+    bool compile(int count, char **files) {
+        _files = files;
+        _count = count;
+        _current = -1;
+        _fp = NULL;
+
+        int romEnd = _asm->getLabelAddress("ROM_END");
+        int patch = _asm->getLabelAddress("CORE_PATCH_LOCATION");
+        _limit = _asm->getConstant("#FENCE");
+        int headers = _asm->getConstant("#HEADERS");
+        if(romEnd == -1 || patch == -1 || _limit == -1) {
+            fprintf(stderr, "Cross compile needs ROM_END, CORE_PATCH_LOCATION and #FENCE\n");
+            return false;
+        }
+        if(headers > romEnd && headers < _limit) {
+            _limit = headers;
+        }
+        _romEnd = romEnd;
+        _dp = variable("%DICTIONARY_POINTER");
+
+        runLines();
+        if(_fp != NULL) {
+            fclose(_fp);
+        }
+
+        uint16_t dp = _vm->read(_dp);
+        if(dp > _limit) {
+            fprintf(stderr, "Cross compiled words overflow ROM: %04x-%04x, limit %04x\n", romEnd, dp, _limit);
+            _errors++;
+        }
+        if(_errors > 0) {
+            fprintf(stderr, "Cross compile failed with %d errors\n", _errors);
+            return false;
+        }
+
+        // Boot with the new words in the core vocabulary
+        uint16_t current = _vm->read(variable("%CURRENT"));
+        _vm->ram()->put(patch + 2, _vm->read(current));
+        fprintf(stderr, "Cross compiled %d bytes at %04x-%04x\n", dp - romEnd, romEnd, dp);
+        return true;
+    }
+
+    protected:
+
+    char **_files;
+    int _count;
+    int _current;
+    FILE *_fp;
+    char *_buf = NULL;
+    size_t _bufSize = 0;
+    int _romEnd;
+    int _limit;
+    int _dp;
+
+    // The next line of source, false when all the files are done
+    bool nextLine(const char **line, size_t *len) {
+        while(true) {
+            ssize_t n;
+            if(_fp != NULL && (n = getline(&_buf, &_bufSize, _fp)) != -1) {
+                _line++;
+                *line = _buf;
+                *len = n > 0 && _buf[n - 1] == '\n' ? n - 1 : n;
+                return true;
+            }
+            if(_fp != NULL) {
+                fclose(_fp);
+                _fp = NULL;
+            }
+            if(++_current >= _count) {
+                return false;
+            }
+            _fp = fopen(_files[_current], "r");
+            _line = 0;
+            if(_fp == NULL) {
+                fprintf(stderr, "%s: cannot open\n", _files[_current]);
+                _errors++;
+            }
+        }
+    }
+
+    const char *path() {
+        return _current < _count ? _files[_current] : "";
+    }
+
+    // Boot is done, compile into ROM from here on
+    void started() {
+        _vm->ram()->put(_dp, _romEnd);
+    }
+};
+#endif
@@ -3,6 +3,10 @@
 
 #include "../runtime/ArduForth/ForthVM.h"
 #include "Assembler.h"
+#include "WatchMemory.h"
+
+// Labels taken from a symbol file written by Dumper::writeSymbols
+#define DEBUGGER_MAX_SYMBOLS 1024
 
 class Debugger
 {
@@ -21,6 +25,55 @@ public:
         _vm = vm;
     }
 
+    void setWatchMemory(WatchMemory *watch)
+    {
+        _watch = watch;
+    }
+
+    bool watch(uint16_t start, uint16_t end)
+    {
+        return _watch != NULL && _watch->watch(start, end);
+    }
+
+    /**
+     * Name words from a symbol file when there is no Assembler, for
+     * images built elsewhere or with the headers stripped
+     */
+    bool loadSymbols(const char *name)
+    {
+        FILE *fp = fopen(name, "r");
+        if (fp == NULL)
+        {
+            return false;
+        }
+        unsigned int addr;
+        char label[64];
+        _numSymbols = 0;
+        while (_numSymbols < DEBUGGER_MAX_SYMBOLS && fscanf(fp, "%x %63s", &addr, label) == 2)
+        {
+            _symbolAddress[_numSymbols] = addr;
+            _symbolName[_numSymbols] = strdup(label);
+            _numSymbols++;
+        }
+        fclose(fp);
+        return true;
+    }
+
+    bool watchSymbol(const char *name, uint16_t bytes = 2)
+    {
+        int addr = labelAddress(name);
+        if (addr == -1 && _asm != NULL)
+        {
+            Symbol *sym = _asm->getSymbol(name);
+            if (sym->token == NULL)
+            {
+                return false;
+            }
+            addr = sym->token->address;
+        }
+        return watch(addr, addr + bytes);
+    }
+
     void setShowForthWordsOnly()
     {
         _showWords = true;
@@ -42,7 +95,7 @@ public:
 
     void setLabelBreakpoint1(const char *name)
     {
-        int addr = _asm->getLabelAddress(name);
+        int addr = labelAddress(name);
         if (addr != -1)
         {
             setBreakpoint1(addr);
@@ -51,7 +104,7 @@ public:
 
     void setLabelBreakpoint2(const char *name)
     {
-        int addr = _asm->getLabelAddress(name);
+        int addr = labelAddress(name);
         if (addr != -1)
         {
             setBreakpoint2(addr);
@@ -59,9 +112,9 @@ public:
     }
     
     void printWALabel(uint16_t wa) {
-        Token *label = _asm->getLabel(wa);
+        const char *label = labelAt(wa, false);
         if(label != NULL) {
-            printf("%s\n", label->name);
+            printf("%s\n", label);
         }
     }
 
@@ -98,8 +151,34 @@ public:
 
     void step()
     {
+        uint16_t pc = _vm->get(REG_PC);
         printCurrentStep();
         _vm->step();
+        if (_watch != NULL && _watch->hit())
+        {
+            watchpoint(pc);
+        }
+    }
+
+    // pc is the storing instruction's, or with resume the one after it
+    // where a run halted by WatchMemory::haltOnHit() carries on
+    void watchpoint(uint16_t pc, bool resume = false)
+    {
+        printf("\nWATCH %04x: %04x -> %04x %s PC %04x",
+               _watch->hitAddress(),
+               _watch->hitOldValue(),
+               _watch->hitNewValue(),
+               resume ? "resuming at" : "at",
+               pc);
+        // report the nearest code label at or before pc
+        const char *best = labelAt(pc, true);
+        if (best != NULL)
+        {
+            printf(" (%s)", best);
+        }
+        printf("\n");
+        _watch->clearHit();
+        _vm->halt();
     }
 
     void run()
@@ -137,10 +216,17 @@ public:
         int8_t n8 = _sex((arga << 4) + argb, 7);
         uint16_t n16 = _vm->ram()->get(pc + 2);
         const char *label = NULL;
-        Token *tok = _asm->getOpcode(pc);
-        if (tok != NULL && tok->label != NULL)
+        if (_asm != NULL)
         {
-            label = tok->label->name;
+            Token *tok = _asm->getOpcode(pc);
+            if (tok != NULL && tok->label != NULL)
+            {
+                label = tok->label->name;
+            }
+        }
+        else
+        {
+            label = labelAt(pc, false);
         }
 
         if (label != NULL) {
@@ -538,14 +624,69 @@ public:
     }
 
 protected:
-    Assembler *_asm;
+    Assembler *_asm = NULL;
     ForthVM *_vm;
+    uint16_t _numSymbols = 0;
+    uint16_t _symbolAddress[DEBUGGER_MAX_SYMBOLS];
+    const char *_symbolName[DEBUGGER_MAX_SYMBOLS];
+    WatchMemory *_watch = NULL;
     uint16_t _breakpoint1, _breakpoint2;
     bool _showWords = false;
     uint16_t _bump = 0;
     uint16_t _steps = 0;
     bool _verbose = false;
 
+    int labelAddress(const char *name)
+    {
+        if (_asm != NULL)
+        {
+            return _asm->getLabelAddress(name);
+        }
+        for (uint16_t i = 0; i < _numSymbols; i++)
+        {
+            if (strcmp(_symbolName[i], name) == 0)
+            {
+                return _symbolAddress[i];
+            }
+        }
+        return -1;
+    }
+
+    // The label at addr, or with nearest the closest code label at or before it
+    const char *labelAt(uint16_t addr, bool nearest)
+    {
+        const char *best = NULL;
+        uint16_t bestAddress = 0;
+        if (_asm != NULL && !nearest)
+        {
+            Token *label = _asm->getLabel(addr);
+            return label == NULL ? NULL : label->name;
+        }
+        if (_asm != NULL)
+        {
+            for (Token *tok = _asm->tokens; tok != NULL; tok = tok->next)
+            {
+                if (tok->isCode() && tok->label != NULL && tok->address <= addr &&
+                    (best == NULL || tok->address > bestAddress))
+                {
+                    best = tok->label->name;
+                    bestAddress = tok->address;
+                }
+            }
+            return best;
+        }
+        for (uint16_t i = 0; i < _numSymbols; i++)
+        {
+            if (_symbolAddress[i] <= addr && (best == NULL || _symbolAddress[i] > bestAddress) &&
+                (nearest || _symbolAddress[i] == addr))
+            {
+                best = _symbolName[i];
+                bestAddress = _symbolAddress[i];
+            }
+        }
+        return best;
+    }
+
     int8_t _sex(uint8_t n, uint8_t b)
     {
 
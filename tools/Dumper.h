@@ -1,8 +1,12 @@
 #ifndef UKMAKER_DUMPER_H
 #define UKMAKER_DUMPER_H
 
+#include <ctype.h>
 #include "Assembler.h"
 
+#define NATIVE_MAX_ENTRIES 1024
+#define NATIVE_MAX_BLOCK 64
+
 class Dumper {
 
     public:
@@ -24,6 +28,8 @@ class Dumper {
             }
             tok = tok->next;
         }
+        // First free address after the variables, the lowest data stack cell
+        fprintf(fp, "#define FORTH_VAREND 0x%04x\n", fasm->getVariablesEnd());
         // Write the ROM image
         if(progmem) {
             fprintf(fp, "const uint8_t rom[%d] PROGMEM = {\n",romSize);
@@ -50,6 +56,124 @@ class Dumper {
         fclose(fp);
     }
 
+    /**
+     * The code region alone, for a deploy that never looks words up.
+     * Needs the headers separated out to #HEADERS, which must follow the code,
+     * and a boot word set with Assembler::setBoot, as OUTER searches the
+     * headers which are left out.
+     */
+    bool writeTurnkeyCPP(const char *name, Assembler *fasm, Memory *mem, bool progmem) {
+        int headers = fasm->getConstant("#HEADERS");
+        if(headers <= 0) {
+            return false;
+        }
+        if(fasm->reaches("OUTER")) {
+            fprintf(stderr, "%s: not written, START still reaches OUTER\n", name);
+            return false;
+        }
+        writeCPP(name, fasm, mem, 0, headers, progmem);
+        return true;
+    }
+
+    /**
+     * Every label as "address name", one per line, for Debugger::loadSymbols
+     */
+    bool writeSymbols(const char *name, Assembler *fasm) {
+        FILE *fp = fopen(name, "w");
+        if(fp == NULL) {
+            return false;
+        }
+        Token *tok = fasm->tokens;
+        while(tok != NULL) {
+            if(tok->isLabel()) {
+                fprintf(fp, "%04x %s\n", tok->address, tok->name);
+            }
+            tok = tok->next;
+        }
+        fclose(fp);
+        return true;
+    }
+
+    /**
+     * Translate the code after each label into a C++ function over the
+     * VM registers, for ForthVM::setNative. Each block runs until it
+     * leaves through a jump, call or return, or reaches an instruction
+     * not translated, and hands the VM the address to carry on from.
+     * The flags and memory accesses go through the VM's own helpers, so
+     * the results match the interpreter. Only valid for this exact image.
+     *
+     * image names the generated code, so that translations of more than
+     * one image can be built together: "Forth" gives the struct
+     * ForthNative<ForthImage>, the table forthNative and FORTH_NATIVE_COUNT.
+     */
+    bool writeNative(const char *name, Assembler *fasm, Memory *mem, const char *image = "Forth") {
+        char upper[32];
+        char lower[32];
+        if(strlen(image) >= sizeof(upper)) {
+            return false;
+        }
+        for(size_t i=0; i<=strlen(image); i++) {
+            upper[i] = toupper(image[i]);
+            lower[i] = i == 0 ? tolower(image[i]) : image[i];
+        }
+        FILE *fp = fopen(name, "w");
+        if(fp == NULL) {
+            return false;
+        }
+        int romEnd = fasm->getLabelAddress("ROM_END");
+        // WRITE-CPP rewrites the code here, so it is always interpreted
+        _patch = fasm->getLabelAddress("CORE_PATCH_LOCATION");
+        Token *entries[NATIVE_MAX_ENTRIES];
+        uint16_t numEntries = 0;
+        // Code labels below ROM_END, in address order with one per address
+        Token *tok = fasm->tokens;
+        while(tok != NULL && numEntries < NATIVE_MAX_ENTRIES) {
+            if(tok->isLabel()) {
+                Token *code = tok->next;
+                while(code != NULL && (code->isLabel() || code->isComment())) {
+                    code = code->next;
+                }
+                if(code != NULL && code->isCode() && code->address == tok->address
+                    && (romEnd == -1 || code->address < romEnd)) {
+                    uint16_t i = numEntries;
+                    while(i > 0 && entries[i - 1]->address > code->address) {
+                        i--;
+                    }
+                    if(i == 0 || entries[i - 1]->address != code->address) {
+                        memmove(&entries[i + 1], &entries[i], (numEntries - i) * sizeof(Token *));
+                        entries[i] = code;
+                        numEntries++;
+                    }
+                }
+            }
+            tok = tok->next;
+        }
+
+        fprintf(fp, "#ifndef UKMAKER_%s_NATIVE_H\n", upper);
+        fprintf(fp, "#define UKMAKER_%s_NATIVE_H\n", upper);
+        fprintf(fp, "// Generated by Dumper::writeNative, include after ForthVM.h\n");
+        fprintf(fp, "struct %sImage;\n", image);
+        fprintf(fp, "template<> struct ForthNative<%sImage> {\n", image);
+        uint16_t written = 0;
+        for(uint16_t i=0; i<numEntries; i++) {
+            if(_writeBlock(fp, fasm, mem, entries[i])) {
+                entries[written++] = entries[i];
+            }
+        }
+        numEntries = written;
+        fprintf(fp, "};\n");
+        fprintf(fp, "#define %s_NATIVE_COUNT %d\n", upper, numEntries);
+        fprintf(fp, "const NativeEntry %sNative[%s_NATIVE_COUNT] = {\n", lower, upper);
+        for(uint16_t i=0; i<numEntries; i++) {
+            fprintf(fp, "    { 0x%04x, ForthNative<%sImage>::f_%04x },\n",
+                entries[i]->address, image, entries[i]->address);
+        }
+        fprintf(fp, "};\n");
+        fprintf(fp, "#endif // UKMAKER_%s_NATIVE_H\n", upper);
+        fclose(fp);
+        return true;
+    }
+
     void dump(Assembler *fasm) {
 
         printf("==============================\n");
@@ -87,6 +211,14 @@ class Dumper {
                             printf("%04x ", tok->address);
                             printf(".DATA: %04x\n", tok->value); 
                             break;
+                        case DIRECTIVE_TYPE_TOKEN: 
+                            printf("%04x ", tok->address);
+                            if(tok->threadTokenSize() == 1) {
+                                printf(".T: %02x\n", tok->arga); 
+                            } else {
+                                printf(".T: %02x %04x\n", tok->arga, tok->value); 
+                            }
+                            break;
                         case DIRECTIVE_TYPE_PLAIN_STRING: 
                             printf("%04x ", tok->address);
                             printf(".SDATA: \"%s\"\n", tok->str); 
@@ -241,5 +373,381 @@ class Dumper {
         }
     }
 
+
+    protected:
+
+    int _patch = -1;
+
+    // One instruction decoded as ForthVM::_clock does
+    struct NativeOp {
+        uint16_t addr;
+        uint16_t next;
+        uint8_t op;
+        uint8_t arga;
+        uint8_t argb;
+        int8_t n4;
+        int8_t n8;
+        uint16_t il;
+        const char *taken; // the condition for a jump, NULL for always
+    };
+
+    static int8_t _sex(uint8_t n, uint8_t b) {
+        return (n & (1 << b)) ? (int8_t)(n | ((0xff >> b) << b)) : (int8_t)n;
+    }
+
+    static bool _hasIL(uint8_t op) {
+        switch(op) {
+            case OP_MOVIL: case OP_STIL: case OP_ADDIL: case OP_SUBIL: case OP_CMPIL:
+            case OP_JP: case OP_JXL: case OP_CALL: case OP_CALLXL:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void _decode(Memory *mem, uint16_t addr, NativeOp &o) {
+        // By condition code, then inverted
+        static const char *conditions[] = {
+            "vm->_c", "vm->_z", "vm->_odd", "vm->_sign",
+            "!vm->_c", "!vm->_z", "!vm->_odd", "!vm->_sign"
+        };
+        uint16_t instr = mem->get(addr);
+        o.addr = addr;
+        o.op = (instr & OP_MASK) >> OP_BITS;
+        o.taken = NULL;
+        if((instr & JP_OR_CALL_MASK) != 0) {
+            o.op = (instr & JP_OR_CALL_OP_MASK) >> OP_BITS;
+            if((instr & CC_APPLY_MASK) != 0) {
+                uint8_t cc = (instr & CC_MASK) >> CC_BITS;
+                o.taken = conditions[cc + ((instr & CC_INV_MASK) != 0 ? 4 : 0)];
+            }
+        }
+        o.arga = (instr & ARGA_MASK) >> ARGA_BITS;
+        o.argb = (instr & ARGB_MASK) >> ARGB_BITS;
+        o.n4 = _sex(o.argb, 3);
+        o.n8 = _sex((o.arga << 4) + o.argb, 7);
+        o.next = addr + 2;
+        o.il = 0;
+        if(_hasIL(o.op)) {
+            o.il = mem->get(o.next);
+            o.next += 2;
+        }
+    }
+
+    // Whether the block can't fall through this one
+    static bool _endsBlock(NativeOp &o) {
+        switch(o.op) {
+            case OP_JP: case OP_JR: case OP_JX: case OP_JXL:
+            case OP_CALL: case OP_CALLR: case OP_CALLX: case OP_CALLXL:
+            case OP_RET:
+                return o.taken == NULL;
+            case OP_MOV:
+                return o.arga == REG_PC;
+            case OP_HALT:
+            case OP_BRK:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static bool _jumpTarget(NativeOp &o, uint16_t *target) {
+        switch(o.op) {
+            case OP_JP: *target = o.il; return true;
+            case OP_JR: *target = o.next + (o.n8 << 1); return true;
+            default: return false;
+        }
+    }
+
+    static int _indexOf(NativeOp *ops, uint16_t count, uint16_t addr) {
+        for(uint16_t i=0; i<count; i++) {
+            if(ops[i].addr == addr) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * Left to the interpreter: BRK and unknown opcodes, and PC as a
+     * register anywhere except MOV
+     */
+    static bool _unsupported(NativeOp &o) {
+        bool usesA = true;
+        bool usesB = false;
+        switch(o.op) {
+            case OP_MOV:
+                return false;
+            case OP_NOP: case OP_MOVAI: case OP_MOVBI: case OP_STAI: case OP_STBI:
+            case OP_STAI_B: case OP_STBI_B: case OP_ADDAI: case OP_ADDBI:
+            case OP_SUBAI: case OP_SUBBI: case OP_CMPAI: case OP_CMPBI:
+            case OP_SYSCALL: case OP_JR: case OP_CALLR: case OP_JP: case OP_CALL:
+            case OP_RET: case OP_HALT: case OP_STIL:
+                return false;
+            case OP_LD: case OP_LD_B: case OP_ST: case OP_ST_B:
+            case OP_ADD: case OP_SUB: case OP_MUL: case OP_DIV:
+            case OP_AND: case OP_OR: case OP_XOR: case OP_CMP:
+            case OP_SL: case OP_SR: case OP_RL: case OP_RR: case OP_RLC: case OP_RRC:
+            case OP_BIT: case OP_SET: case OP_CLR:
+                usesB = true;
+                break;
+            case OP_MOVI: case OP_MOVIL: case OP_LDAX: case OP_LDBX: case OP_LDAX_B: case OP_LDBX_B:
+            case OP_STI: case OP_STI_B: case OP_STXA: case OP_STXB: case OP_STXA_B: case OP_STXB_B:
+            case OP_PUSHD: case OP_PUSHR: case OP_POPD: case OP_POPR:
+            case OP_ADDI: case OP_ADDIL: case OP_SUBI: case OP_SUBIL: case OP_CMPI: case OP_CMPIL:
+            case OP_NOT: case OP_SLI: case OP_SRI: case OP_RLI: case OP_RRI: case OP_RLCI: case OP_RRCI:
+            case OP_BITI: case OP_SETI: case OP_CLRI:
+            case OP_JX: case OP_JXL: case OP_CALLX: case OP_CALLXL:
+                break;
+            default:
+                return true;
+        }
+        return (usesA && o.arga == REG_PC) || (usesB && o.argb == REG_PC);
+    }
+
+    // @return false when not even the first instruction can be translated
+    bool _writeBlock(FILE *fp, Assembler *fasm, Memory *mem, Token *code) {
+        NativeOp ops[NATIVE_MAX_BLOCK];
+        bool targets[NATIVE_MAX_BLOCK];
+        uint16_t count = 0;
+        uint16_t addr = code->address;
+        Token *tok = code;
+        while(tok != NULL && count < NATIVE_MAX_BLOCK) {
+            if(tok->isLabel() || tok->isComment()) {
+                tok = tok->next;
+                continue;
+            }
+            if(!tok->isCode() || tok->address != addr || addr == _patch) {
+                break;
+            }
+            _decode(mem, addr, ops[count]);
+            if(_unsupported(ops[count])) {
+                break;
+            }
+            targets[count] = false;
+            addr = ops[count].next;
+            if(_endsBlock(ops[count++])) {
+                break;
+            }
+            tok = tok->next;
+        }
+        // Jumps inside the block become gotos
+        for(uint16_t i=0; i<count; i++) {
+            uint16_t target;
+            int j;
+            if(_jumpTarget(ops[i], &target) && (j = _indexOf(ops, count, target)) != -1) {
+                targets[j] = true;
+            }
+        }
+
+        if(count == 0) {
+            return false;
+        }
+
+        Token *label = fasm->getLabel(code->address);
+        if(label != NULL) {
+            fprintf(fp, "    // %s\n", label->name);
+        }
+        fprintf(fp, "    static uint16_t f_%04x(ForthVM *vm) {\n", code->address);
+        fprintf(fp, "        (void)vm;\n"); // Unused by a block which only jumps
+        bool open = true;
+        for(uint16_t i=0; i<count && open; i++) {
+            if(targets[i]) {
+                fprintf(fp, "    L_%04x:\n", ops[i].addr);
+            }
+            open = _writeOp(fp, ops[i], ops, count);
+        }
+        if(open) {
+            fprintf(fp, "        return 0x%04x;\n", addr);
+        }
+        fprintf(fp, "    }\n");
+        return true;
+    }
+
+    // A register read, PC reads as the address after the instruction
+    static const char *_regName(uint8_t reg) {
+        static const char *names[] = {
+            "REG_0", "REG_1", "REG_2", "REG_3", "REG_4", "REG_5", "REG_6", "REG_7",
+            "REG_A", "REG_B", "REG_I", "REG_CA", "REG_WA", "REG_SP", "REG_RS", "REG_PC"
+        };
+        return names[reg & 0x0f];
+    }
+
+    const char *_reg(NativeOp &o, uint8_t reg, char *buf) {
+        if(reg == REG_PC) {
+            sprintf(buf, "0x%04x", o.next);
+        } else {
+            sprintf(buf, "vm->_regs[%s]", _regName(reg));
+        }
+        return buf;
+    }
+
+    // Leave the block when a push, pop or syscall has halted or trapped
+    void _checkHalted(FILE *fp, NativeOp &o) {
+        fprintf(fp, "        if(vm->_halted) return 0x%04x;\n", o.next);
+    }
+
+    void _writeCall(FILE *fp, NativeOp &o, const char *target) {
+        if(o.taken == NULL) {
+            fprintf(fp, "        vm->_pushr(0x%04x);\n", o.next);
+            fprintf(fp, "        return %s;\n", target);
+        } else {
+            fprintf(fp, "        if(%s) {\n", o.taken);
+            fprintf(fp, "            vm->_pushr(0x%04x);\n", o.next);
+            fprintf(fp, "            return %s;\n", target);
+            fprintf(fp, "        }\n");
+        }
+    }
+
+    // Emit one instruction, @return false once control has left the block
+    bool _writeOp(FILE *fp, NativeOp &o, NativeOp *ops, uint16_t count) {
+        char a[32];
+        char b[32];
+        uint8_t ra = o.arga;
+        uint8_t rb = o.argb;
+        uint16_t target = 0;
+        char when[32] = "";
+        if(o.taken != NULL) {
+            sprintf(when, "if(%s) ", o.taken);
+        }
+        switch(o.op) {
+            case OP_NOP: break;
+            case OP_MOV:
+                if(ra == REG_PC) {
+                    fprintf(fp, "        return %s;\n", _reg(o, rb, b));
+                    return false;
+                }
+                fprintf(fp, "        vm->_regs[%s] = %s;\n", _regName(ra), _reg(o, rb, b));
+                break;
+            case OP_MOVI: fprintf(fp, "        vm->_regs[%s] = 0x%04x;\n", _regName(ra), (uint16_t)o.n4); break;
+            case OP_MOVIL: fprintf(fp, "        vm->_regs[%s] = 0x%04x;\n", _regName(ra), o.il); break;
+            case OP_MOVAI: fprintf(fp, "        vm->_regs[REG_A] = 0x%04x;\n", (uint16_t)o.n8); break;
+            case OP_MOVBI: fprintf(fp, "        vm->_regs[REG_B] = 0x%04x;\n", (uint16_t)o.n8); break;
+            case OP_LD: fprintf(fp, "        vm->_regs[%s] = vm->_get(%s);\n", _regName(ra), _reg(o, rb, b)); break;
+            case OP_LD_B: fprintf(fp, "        vm->_regs[%s] = vm->_getC(%s);\n", _regName(ra), _reg(o, rb, b)); break;
+            case OP_LDAX: fprintf(fp, "        vm->_regs[REG_A] = vm->_get(%s + %d);\n", _reg(o, ra, a), o.n4 * 2); break;
+            case OP_LDBX: fprintf(fp, "        vm->_regs[REG_B] = vm->_get(%s + %d);\n", _reg(o, ra, a), o.n4 * 2); break;
+            case OP_LDAX_B: fprintf(fp, "        vm->_regs[REG_A] = vm->_getC(%s + %d);\n", _reg(o, ra, a), o.n4 * 2); break;
+            case OP_LDBX_B: fprintf(fp, "        vm->_regs[REG_B] = vm->_getC(%s + %d);\n", _reg(o, ra, a), o.n4 * 2); break;
+            case OP_ST: fprintf(fp, "        vm->_put(%s, %s);\n", _reg(o, ra, a), _reg(o, rb, b)); break;
+            case OP_ST_B: fprintf(fp, "        vm->_putC(%s, %s);\n", _reg(o, ra, a), _reg(o, rb, b)); break;
+            case OP_STI: fprintf(fp, "        vm->_put(%s, 0x%04x);\n", _reg(o, ra, a), (uint16_t)o.n4); break;
+            case OP_STAI: fprintf(fp, "        vm->_put(vm->_regs[REG_A], 0x%04x);\n", (uint16_t)o.n8); break;
+            // As the interpreter does it
+            case OP_STBI: fprintf(fp, "        vm->_putC(vm->_regs[REG_B], 0x%02x);\n", (uint8_t)o.n8); break;
+            case OP_STIL: fprintf(fp, "        vm->_put(%d, 0x%04x);\n", ra, o.il); break;
+            case OP_STI_B: fprintf(fp, "        vm->_putC(%s, 0x%02x);\n", _reg(o, ra, a), (uint8_t)o.n4); break;
+            case OP_STAI_B: fprintf(fp, "        vm->_putC(vm->_regs[REG_A], 0x%02x);\n", (uint8_t)o.n8); break;
+            case OP_STBI_B: fprintf(fp, "        vm->_putC(vm->_regs[REG_B], 0x%02x);\n", (uint8_t)o.n8); break;
+            case OP_STXA: fprintf(fp, "        vm->_put(%s + %d, vm->_regs[REG_A]);\n", _reg(o, ra, a), o.n4 * 2); break;
+            case OP_STXB: fprintf(fp, "        vm->_put(%s + %d, vm->_regs[REG_B]);\n", _reg(o, ra, a), o.n4 * 2); break;
+            case OP_STXA_B: fprintf(fp, "        vm->_putC(%s + %d, vm->_regs[REG_A]);\n", _reg(o, ra, a), o.n4); break;
+            case OP_STXB_B: fprintf(fp, "        vm->_putC(%s + %d, vm->_regs[REG_B]);\n", _reg(o, ra, a), o.n4); break;
+            case OP_PUSHD:
+                fprintf(fp, "        vm->_pushd(%s);\n", _reg(o, ra, a));
+                _checkHalted(fp, o);
+                break;
+            case OP_PUSHR:
+                fprintf(fp, "        vm->_pushr(%s);\n", _reg(o, ra, a));
+                _checkHalted(fp, o);
+                break;
+            case OP_POPD:
+                fprintf(fp, "        vm->_regs[%s] = vm->_popd();\n", _regName(ra));
+                _checkHalted(fp, o);
+                break;
+            case OP_POPR:
+                fprintf(fp, "        vm->_regs[%s] = vm->_popr();\n", _regName(ra));
+                _checkHalted(fp, o);
+                break;
+            case OP_ADD: fprintf(fp, "        vm->_add(%s, %s);\n", _regName(ra), _regName(rb)); break;
+            case OP_ADDI: fprintf(fp, "        vm->_addi(%s, %d);\n", _regName(ra), o.n4); break;
+            case OP_ADDAI: fprintf(fp, "        vm->_addi(REG_A, %d);\n", o.n8); break;
+            case OP_ADDBI: fprintf(fp, "        vm->_addi(REG_B, %d);\n", o.n8); break;
+            case OP_ADDIL: fprintf(fp, "        vm->_addl(%s, 0x%04x);\n", _regName(ra), o.il); break;
+            case OP_CMP: fprintf(fp, "        vm->_cmp(%s, %s);\n", _regName(ra), _regName(rb)); break;
+            case OP_CMPI: fprintf(fp, "        vm->_cmpi(%s, 0x%02x);\n", _regName(ra), (uint8_t)o.n4); break;
+            case OP_CMPAI: fprintf(fp, "        vm->_cmpi(REG_A, 0x%02x);\n", (uint8_t)o.n8); break;
+            case OP_CMPBI: fprintf(fp, "        vm->_cmpi(REG_B, 0x%02x);\n", (uint8_t)o.n8); break;
+            case OP_CMPIL: fprintf(fp, "        vm->_cmpl(%s, 0x%04x);\n", _regName(ra), o.il); break;
+            case OP_SUB: fprintf(fp, "        vm->_sub(%s, %s);\n", _regName(ra), _regName(rb)); break;
+            case OP_SUBI: fprintf(fp, "        vm->_subi4(%s, %d);\n", _regName(ra), o.n4); break;
+            case OP_SUBAI: fprintf(fp, "        vm->_subi(REG_A, %d);\n", o.n8); break;
+            case OP_SUBBI: fprintf(fp, "        vm->_subi(REG_B, %d);\n", o.n8); break;
+            case OP_SUBIL: fprintf(fp, "        vm->_subl(%s, 0x%04x);\n", _regName(ra), o.il); break;
+            case OP_MUL: fprintf(fp, "        vm->_mul(%s, %s);\n", _regName(ra), _regName(rb)); break;
+            case OP_DIV: fprintf(fp, "        vm->_div(%s, %s);\n", _regName(ra), _regName(rb)); break;
+            case OP_AND: fprintf(fp, "        vm->_and(%s, %s);\n", _regName(ra), _regName(rb)); break;
+            case OP_OR: fprintf(fp, "        vm->_or(%s, %s);\n", _regName(ra), _regName(rb)); break;
+            case OP_NOT: fprintf(fp, "        vm->_not(%s);\n", _regName(ra)); break;
+            case OP_XOR: fprintf(fp, "        vm->_xor(%s, %s);\n", _regName(ra), _regName(rb)); break;
+            case OP_SLI: fprintf(fp, "        vm->_sl(%s, %d);\n", _regName(ra), rb); break;
+            case OP_SRI: fprintf(fp, "        vm->_sr(%s, %d);\n", _regName(ra), rb); break;
+            case OP_RLI: fprintf(fp, "        vm->_rl(%s, %d);\n", _regName(ra), rb); break;
+            case OP_RRI: fprintf(fp, "        vm->_rr(%s, %d);\n", _regName(ra), rb); break;
+            case OP_RLCI: fprintf(fp, "        vm->_rlc(%s, %d);\n", _regName(ra), rb); break;
+            case OP_RRCI: fprintf(fp, "        vm->_rrc(%s, %d);\n", _regName(ra), rb); break;
+            case OP_BITI: fprintf(fp, "        vm->_bit(%s, %d);\n", _regName(ra), rb); break;
+            case OP_SETI: fprintf(fp, "        vm->_set(%s, %d);\n", _regName(ra), rb); break;
+            case OP_CLRI: fprintf(fp, "        vm->_clr(%s, %d);\n", _regName(ra), rb); break;
+            case OP_SL: fprintf(fp, "        vm->_sl(%s, vm->_regs[%s]);\n", _regName(ra), _regName(rb)); break;
+            case OP_SR: fprintf(fp, "        vm->_sr(%s, vm->_regs[%s]);\n", _regName(ra), _regName(rb)); break;
+            case OP_RL: fprintf(fp, "        vm->_rl(%s, vm->_regs[%s]);\n", _regName(ra), _regName(rb)); break;
+            case OP_RR: fprintf(fp, "        vm->_rr(%s, vm->_regs[%s]);\n", _regName(ra), _regName(rb)); break;
+            case OP_RLC: fprintf(fp, "        vm->_rlc(%s, vm->_regs[%s]);\n", _regName(ra), _regName(rb)); break;
+            case OP_RRC: fprintf(fp, "        vm->_rrc(%s, vm->_regs[%s]);\n", _regName(ra), _regName(rb)); break;
+            case OP_BIT: fprintf(fp, "        vm->_bit(%s, vm->_regs[%s]);\n", _regName(ra), _regName(rb)); break;
+            case OP_SET: fprintf(fp, "        vm->_set(%s, vm->_regs[%s]);\n", _regName(ra), _regName(rb)); break;
+            case OP_CLR: fprintf(fp, "        vm->_clr(%s, vm->_regs[%s]);\n", _regName(ra), _regName(rb)); break;
+
+            case OP_JP:
+            case OP_JR:
+                _jumpTarget(o, &target);
+                if(_indexOf(ops, count, target) != -1) {
+                    fprintf(fp, "        %sgoto L_%04x;\n", when, target);
+                } else {
+                    fprintf(fp, "        %sreturn 0x%04x;\n", when, target);
+                }
+                return o.taken != NULL;
+            case OP_JX:
+                fprintf(fp, "        %sreturn %s + %d;\n", when, _reg(o, ra, a), o.n4 * 2);
+                return o.taken != NULL;
+            case OP_JXL:
+                fprintf(fp, "        %sreturn %s + 0x%04x;\n", when, _reg(o, ra, a), o.il);
+                return o.taken != NULL;
+            // A call leaves the block, the return lands back in the interpreter
+            case OP_CALL:
+                sprintf(b, "0x%04x", o.il);
+                _writeCall(fp, o, b);
+                return o.taken != NULL;
+            case OP_CALLR:
+                sprintf(b, "0x%04x", (uint16_t)(o.next + (o.n8 << 1)));
+                _writeCall(fp, o, b);
+                return o.taken != NULL;
+            case OP_CALLX:
+                sprintf(b, "%s + %d", _reg(o, ra, a), o.n4 * 2);
+                _writeCall(fp, o, b);
+                return o.taken != NULL;
+            case OP_CALLXL:
+                sprintf(b, "%s + 0x%04x", _reg(o, ra, a), o.il);
+                _writeCall(fp, o, b);
+                return o.taken != NULL;
+            case OP_RET:
+                fprintf(fp, "        %sreturn vm->_popr();\n", when);
+                return o.taken != NULL;
+            case OP_SYSCALL:
+                // Syscalls may look at PC, e.g. syscall_unimplemented
+                fprintf(fp, "        vm->_regs[REG_PC] = 0x%04x;\n", o.next);
+                fprintf(fp, "        vm->syscall(0x%04x);\n", (uint16_t)o.n8);
+                _checkHalted(fp, o);
+                break;
+            case OP_HALT:
+                fprintf(fp, "        vm->_halted = true;\n");
+                fprintf(fp, "        return 0x%04x;\n", o.next);
+                return false;
+            default:
+                break;
+        }
+        return true;
+    }
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,136 @@
+#ifndef UKMAKER_FRAME_DECODER_H
+#define UKMAKER_FRAME_DECODER_H
+
+#include <stdio.h>
+#include <string.h>
+#include "../runtime/ArduForth/Telemetry.h"
+
+/**
+ * Decode the telemetry records FRAME> sends, e.g. a capture of the serial
+ * port, to text: one line per record, the type and then the values, cells
+ * and doubles both signed.
+ *
+ * Input is read in blocks and decoded as a stream, so it can be a device
+ * as well as a file. Bytes between records, such as the interpreter's own
+ * output, are skipped. A record with a bad CRC or tag is counted and
+ * decoding picks up again at the next sync byte after its start.
+ */
+
+#define FRAME_DECODE_BLOCK 4096
+
+class FrameDecoder {
+
+    public:
+
+    FrameDecoder(FILE *out) : _out(out), _fill(0), _records(0), _bad(0), _skipped(0) {}
+    ~FrameDecoder() {}
+
+    /**
+     * Decode the file at path, "-" for stdin
+     * @return false if it can't be read or had bad records
+     */
+    bool decode(const char *path) {
+        FILE *fp = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+        if(fp == NULL) {
+            fprintf(stderr, "%s: cannot open\n", path);
+            return false;
+        }
+        uint8_t buf[FRAME_DECODE_BLOCK];
+        size_t n;
+        while((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+            feed(buf, n);
+        }
+        bool ok = !ferror(fp);
+        if(fp != stdin) {
+            fclose(fp);
+        }
+        _skipped += _fill; // A record cut off at the end
+        _fill = 0;
+        fflush(_out);
+        fprintf(stderr, "%s: %lu records, %lu bad, %lu bytes skipped%s\n", path,
+            _records, _bad, _skipped, ok ? "" : ", read error");
+        return ok && _bad == 0;
+    }
+
+    void feed(const uint8_t *p, size_t len) {
+        for(size_t i=0; i<len; i++) {
+            _byte(p[i]);
+        }
+    }
+
+    unsigned long records() {
+        return _records;
+    }
+
+    unsigned long bad() {
+        return _bad;
+    }
+
+    protected:
+
+    FILE *_out;
+    uint8_t _rec[FRAME_MAX];
+    size_t _fill;
+    unsigned long _records;
+    unsigned long _bad;
+    unsigned long _skipped;
+
+    void _byte(uint8_t b) {
+        if(_fill == 0 && b != FRAME_SYNC) {
+            _skipped++;
+            return;
+        }
+        _rec[_fill++] = b;
+        if(_fill == 2 && (b == 0 || b > FRAME_MAX - 2 - FRAME_CRC)) {
+            _resync(); // Not a length, so that wasn't a sync byte
+            return;
+        }
+        if(_fill < 2 || _fill < (size_t)_rec[1] + 2 + FRAME_CRC) {
+            return;
+        }
+        uint16_t crc = _rec[_fill - 2] | (_rec[_fill - 1] << 8);
+        if(crc != frame_crc(_rec + 1, _fill - 1 - FRAME_CRC) || !_print()) {
+            _bad++;
+            _resync();
+            return;
+        }
+        _records++;
+        _fill = 0;
+    }
+
+    // Skip the sync byte of a failed record and look again at the rest
+    void _resync() {
+        uint8_t rest[FRAME_MAX];
+        size_t n = _fill - 1;
+        memcpy(rest, _rec + 1, n);
+        _fill = 0;
+        _skipped++;
+        feed(rest, n);
+    }
+
+    // Write a checked record, @return false if it has an unknown tag
+    bool _print() {
+        char line[FRAME_MAX * 6];
+        int len = snprintf(line, sizeof(line), "%u", _rec[2]);
+        size_t end = _fill - FRAME_CRC;
+        size_t i = FRAME_HEADER;
+        while(i < end) {
+            uint8_t tag = _rec[i++];
+            if(tag == FRAME_TAG_CELL && i + 2 <= end) {
+                int16_t v = _rec[i] | (_rec[i + 1] << 8);
+                len += snprintf(line + len, sizeof(line) - len, " %d", v);
+                i += 2;
+            } else if(tag == FRAME_TAG_DOUBLE && i + 4 <= end) {
+                int32_t v = (int32_t)((uint32_t)_rec[i] | ((uint32_t)_rec[i + 1] << 8) |
+                    ((uint32_t)_rec[i + 2] << 16) | ((uint32_t)_rec[i + 3] << 24));
+                len += snprintf(line + len, sizeof(line) - len, " %ld", (long)v);
+                i += 4;
+            } else {
+                return false;
+            }
+        }
+        fprintf(_out, "%s\n", line);
+        return true;
+    }
+};
+#endif
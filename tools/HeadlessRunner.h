@@ -0,0 +1,196 @@
+#ifndef UKMAKER_HEADLESS_RUNNER_H
+#define UKMAKER_HEADLESS_RUNNER_H
+
+#include <stdio.h>
+#include <string.h>
+#include "../runtime/ArduForth/ForthVM.h"
+#include "../runtime/ArduForth/syscalls.h"
+#include "Assembler.h"
+#include "host_syscalls.h"
+
+/**
+ * Boots the assembled core with no console and feeds it lines from the
+ * host, the common part of BatchRunner and CrossCompiler.
+ *
+ * The lines don't go through the line buffer: the runner is the outermost
+ * host source (see SourceStream.h and %SOURCE in core.fasm) and INLINE
+ * only moves it on a line, so TOKEN reads each line where it is and lines
+ * can be any length. STREAM_FILE nests inside as usual. A restart after
+ * an error drops the host sources and the next INLINE opens the runner
+ * again, losing only the line that failed.
+ *
+ * The banner and the prompts are dropped and nothing is printed before
+ * the first line is asked for. A system message (any MSG_ label other
+ * than the banner and the prompt) is counted as an error and written to
+ * stderr after the path and line that caused it, along with whatever the
+ * interpreter types after it, e.g. the unknown token, up to the next
+ * line.
+ *
+ * A subclass supplies the lines, counting them in _line, and stops the
+ * run after an error by returning no more.
+ */
+class HeadlessRunner {
+
+    public:
+
+    HeadlessRunner(Assembler *fasm, ForthVM *vm) : _asm(fasm), _vm(vm) {}
+    virtual ~HeadlessRunner() {}
+
+    int errors() {
+        return _errors;
+    }
+
+    protected:
+
+    static inline HeadlessRunner *_active = NULL;
+
+    Assembler *_asm;
+    ForthVM *_vm;
+    int _line = 0;
+    int _errors = 0;
+    bool _started = false;
+    bool _reporting = false;
+    int _hello = -1;
+    int _prompt = -1;
+    int _source = -1;
+    const char *_rest = NULL; // What the source has yet to be given of a line
+    size_t _restLen = 0;
+    bool _feeding = false;    // Until the line's newline has been given
+
+    // The next line without its newline, false when the input is done
+    virtual bool nextLine(const char **line, size_t *len) = 0;
+
+    // Where the current line came from
+    virtual const char *path() = 0;
+
+    // The core has booted and asks for its first line
+    virtual void started() {}
+
+    int variable(const char *name) {
+        Symbol *sym = _asm->getSymbol(name);
+        return sym->token == NULL ? -1 : sym->token->address;
+    }
+
+    // Boot the core and feed it lines until they run out or it halts
+    void runLines() {
+        _line = 0;
+        _errors = 0;
+        _started = false;
+        _reporting = false;
+        _feeding = false;
+        _hello = _asm->getLabelAddress("MSG_HELLO");
+        _prompt = _asm->getLabelAddress("MSG_PROMPT");
+        _source = variable("%SOURCE");
+        if(_source == -1) {
+            fprintf(stderr, "Headless runs need %%SOURCE\n");
+            _errors++;
+            return;
+        }
+
+        _active = this;
+        _vm->addSyscall(SYSCALL_INLINE, syscall_headless_inline);
+        _vm->addSyscall(SYSCALL_TYPE, syscall_headless_type);
+        _vm->addSyscall(SYSCALL_PUTC, syscall_headless_putc);
+        _vm->reset();
+        _vm->run();
+        _vm->addSyscall(SYSCALL_INLINE, syscall_inline);
+        _vm->addSyscall(SYSCALL_TYPE, syscall_type);
+        _vm->addSyscall(SYSCALL_PUTC, syscall_putc);
+        _active = NULL;
+        host_sources_drop(0);
+        _vm->ram()->put(_source, 0);
+        endReport();
+    }
+
+    // Start an error report on stderr, it runs to the next line
+    void report() {
+        if(_reporting) {
+            return;
+        }
+        fflush(stdout);
+        fprintf(stderr, "%s:%d: ", path(), _line);
+        _reporting = true;
+        _errors++;
+    }
+
+    void endReport() {
+        if(_reporting) {
+            fputc('\n', stderr);
+            _reporting = false;
+        }
+    }
+
+    // The source takes one line at a time, so nothing past it is lost
+    // when a restart drops the source
+    static size_t _headless_refill(void *context, char *buf, size_t len) {
+        HeadlessRunner *hr = (HeadlessRunner *)context;
+        if(!hr->_feeding) {
+            if(!hr->nextLine(&hr->_rest, &hr->_restLen)) {
+                return 0;
+            }
+            hr->_feeding = true;
+        }
+        size_t n = hr->_restLen < len ? hr->_restLen : len;
+        memcpy(buf, hr->_rest, n);
+        hr->_rest += n;
+        hr->_restLen -= n;
+        if(hr->_restLen == 0 && n < len) {
+            buf[n++] = 0x0a;
+            hr->_feeding = false;
+        }
+        return n;
+    }
+
+    static void syscall_headless_inline(ForthVM *vm) {
+        HeadlessRunner *hr = _active;
+        vm->pop(); // The line buffer isn't used
+        hr->endReport();
+        if(!hr->_started) {
+            hr->_started = true;
+            hr->started();
+        }
+        host_sources_drop(vm->read(hr->_source));
+        if(host_source() == NULL) {
+            hr->_feeding = false;
+            vm->ram()->put(hr->_source, host_source_open(_headless_refill, NULL, hr));
+        }
+        if(!host_source()->nextLine()) {
+            vm->push(0x00);
+            vm->halt();
+            return;
+        }
+        vm->push(0x01);
+    }
+
+    // Nothing is printed before the first line but the banner's newline
+    static void syscall_headless_putc(ForthVM *vm) {
+        if(_active->_started) {
+            syscall_putc(vm);
+        } else {
+            vm->pop();
+        }
+    }
+
+    // Drop the banner and prompts, send messages and what follows to stderr
+    static void syscall_headless_type(ForthVM *vm) {
+        HeadlessRunner *hr = _active;
+        uint16_t addr = vm->pop();
+        if(addr == hr->_hello || addr == hr->_prompt) {
+            return;
+        }
+        if(!hr->_reporting) {
+            Token *label = hr->_asm->getLabel(addr);
+            if(label == NULL || strncmp(label->name, "MSG_", 4) != 0) {
+                vm->push(addr);
+                syscall_type(vm);
+                return;
+            }
+            hr->report();
+        }
+        uint16_t len = vm->read(addr);
+        for(uint16_t i = 0; i < len; i++) {
+            fputc(vm->readByte(addr + 2 + i), stderr);
+        }
+    }
+};
+#endif
@@ -0,0 +1,246 @@
+#ifndef UKMAKER_RECORDING_MEMORY_H
+#define UKMAKER_RECORDING_MEMORY_H
+
+#include <stdio.h>
+#include <string.h>
+#include "../runtime/ArduForth/Memory.h"
+#include "Assembler.h"
+
+/**
+ * Access recording for the host tools.
+ *
+ * Wraps another Memory and counts reads and writes per 16 byte line. The
+ * counts are reported over named regions, normally the address map from
+ * core.fasm, together with high-water marks for the two stacks. Use it to
+ * size #SPTOP/#RSTOP and the dictionary for small targets.
+ */
+
+#define RECORD_LINE_BITS 4
+#define RECORD_LINES (0x10000 >> RECORD_LINE_BITS)
+#define RECORD_MAX_REGIONS 8
+
+class RecordingMemory : public Memory {
+
+    public:
+
+    RecordingMemory(Memory *memory) :
+        Memory(NULL, 0, 0, NULL, 0, 0), _memory(memory)
+        {
+            _numRegions = 0;
+            _dsLimit = _dsTop = 0;
+            _rsLimit = _rsTop = 0;
+            clear();
+        }
+
+    ~RecordingMemory() {}
+
+    void clear() {
+        memset(_reads, 0, sizeof(_reads));
+        memset(_writes, 0, sizeof(_writes));
+        _dsLow = _dsTop;
+        _rsLow = _rsTop;
+    }
+
+    /**
+     * Name the bytes from start up to but not including end
+     */
+    bool addRegion(const char *name, uint16_t start, uint16_t end) {
+        if(_numRegions == RECORD_MAX_REGIONS) {
+            return false;
+        }
+        _regionName[_numRegions] = name;
+        _regionStart[_numRegions] = start;
+        _regionEnd[_numRegions] = end;
+        _numRegions++;
+        return true;
+    }
+
+    /**
+     * Both stacks grow down from their top cell. Stores below the limit
+     * belong to something else and are not counted.
+     */
+    void setDataStack(uint16_t limit, uint16_t top) {
+        _dsLimit = limit;
+        _dsTop = _dsLow = top;
+    }
+
+    void setReturnStack(uint16_t limit, uint16_t top) {
+        _rsLimit = limit;
+        _rsTop = _rsLow = top;
+    }
+
+    /**
+     * Take the regions and stacks from the address map in core.fasm
+     */
+    void addRegions(Assembler *fasm) {
+        int ramStart = fasm->getConstant("#RAMSTART");
+        int varStart = fasm->getConstant("#VARSTART");
+        int spTop = fasm->getConstant("#SPTOP");
+        int rsTop = fasm->getConstant("#RSTOP");
+        int varEnd = fasm->getVariablesEnd();
+        if(ramStart == -1 || varStart == -1 || spTop == -1 || rsTop == -1 || varEnd == -1) {
+            return;
+        }
+        addRegion("CODE", 0, ramStart);
+        addRegion("DICTIONARY", ramStart, varStart);
+        addRegion("VARIABLES", varStart, varEnd);
+        addRegion("DSTACK", varEnd, spTop + 2);
+        addRegion("RSTACK", spTop + 2, rsTop + 2);
+        setDataStack(varEnd, spTop);
+        setReturnStack(spTop + 2, rsTop);
+    }
+
+    uint32_t reads(uint16_t addr) {
+        return _reads[addr >> RECORD_LINE_BITS];
+    }
+
+    uint32_t writes(uint16_t addr) {
+        return _writes[addr >> RECORD_LINE_BITS];
+    }
+
+    // Accesses to the lines of region i, in the order they were added
+    uint32_t regionReads(uint8_t i) {
+        return _regionTotal(_reads, i);
+    }
+
+    uint32_t regionWrites(uint8_t i) {
+        return _regionTotal(_writes, i);
+    }
+
+    // Deepest use of each stack in bytes
+    uint16_t dataStackHighWater() {
+        return _dsTop - _dsLow;
+    }
+
+    uint16_t returnStackHighWater() {
+        return _rsTop - _rsLow;
+    }
+
+    void put(uint16_t addr, uint16_t w) {
+        _write(addr);
+        _memory->put(addr, w);
+    }
+
+    uint16_t get(uint16_t addr) {
+        _reads[addr >> RECORD_LINE_BITS]++;
+        return _memory->get(addr);
+    }
+
+    void putC(uint16_t addr, uint8_t c) {
+        _write(addr);
+        _memory->putC(addr, c);
+    }
+
+    uint8_t getC(uint16_t addr) {
+        _reads[addr >> RECORD_LINE_BITS]++;
+        return _memory->getC(addr);
+    }
+
+    uint8_t *addressOfChar(uint16_t location) {
+        return _memory->addressOfChar(location);
+    }
+
+    uint16_t *addressOfWord(uint16_t location) {
+        return _memory->addressOfWord(location);
+    }
+
+    // Keep bulk reads going through getC so they are counted
+    bool inRam(uint16_t, uint16_t) {
+        return false;
+    }
+
+    uint32_t romCacheHits() {
+        return _memory->romCacheHits();
+    }
+
+    uint32_t romCacheMisses() {
+        return _memory->romCacheMisses();
+    }
+
+    /**
+     * Summary per region: lines touched and total accesses
+     */
+    void report(FILE *fp) {
+        fprintf(fp, "==============================\n");
+        fprintf(fp, "Memory access report\n");
+        fprintf(fp, "==============================\n");
+        for(uint8_t i=0; i<_numRegions; i++) {
+            uint16_t lines = 0;
+            uint16_t touched = 0;
+            for(uint32_t line = _regionStart[i] >> RECORD_LINE_BITS;
+                (line << RECORD_LINE_BITS) < _regionEnd[i]; line++) {
+                lines++;
+                if(_reads[line] != 0 || _writes[line] != 0) {
+                    touched++;
+                }
+            }
+            fprintf(fp, "%-12s %04x-%04x lines %3d/%-3d reads %10u writes %10u\n",
+                _regionName[i], _regionStart[i], _regionEnd[i] - 1,
+                touched, lines, regionReads(i), regionWrites(i));
+        }
+        if(_dsTop != 0) {
+            fprintf(fp, "DSTACK high water %d bytes (lowest %04x, limit %04x)\n",
+                dataStackHighWater(), _dsLow, _dsLimit);
+        }
+        if(_rsTop != 0) {
+            fprintf(fp, "RSTACK high water %d bytes (lowest %04x, limit %04x)\n",
+                returnStackHighWater(), _rsLow, _rsLimit);
+        }
+    }
+
+    /**
+     * The heatmap as CSV, one row per touched line inside a region
+     */
+    bool writeHeatmap(const char *name) {
+        FILE *fp = fopen(name, "w");
+        if(fp == NULL) {
+            return false;
+        }
+        fprintf(fp, "region,address,reads,writes\n");
+        for(uint8_t i=0; i<_numRegions; i++) {
+            for(uint32_t line = _regionStart[i] >> RECORD_LINE_BITS;
+                (line << RECORD_LINE_BITS) < _regionEnd[i]; line++) {
+                if(_reads[line] != 0 || _writes[line] != 0) {
+                    fprintf(fp, "%s,0x%04x,%u,%u\n", _regionName[i],
+                        line << RECORD_LINE_BITS, _reads[line], _writes[line]);
+                }
+            }
+        }
+        fclose(fp);
+        return true;
+    }
+
+    protected:
+
+    Memory *_memory;
+
+    uint32_t _reads[RECORD_LINES];
+    uint32_t _writes[RECORD_LINES];
+
+    uint8_t _numRegions;
+    const char *_regionName[RECORD_MAX_REGIONS];
+    uint16_t _regionStart[RECORD_MAX_REGIONS];
+    uint16_t _regionEnd[RECORD_MAX_REGIONS];
+
+    uint16_t _dsLimit, _dsTop, _dsLow;
+    uint16_t _rsLimit, _rsTop, _rsLow;
+
+    uint32_t _regionTotal(uint32_t *counts, uint8_t i) {
+        uint32_t total = 0;
+        for(uint32_t line = _regionStart[i] >> RECORD_LINE_BITS;
+            (line << RECORD_LINE_BITS) < _regionEnd[i]; line++) {
+            total += counts[line];
+        }
+        return total;
+    }
+
+    void _write(uint16_t addr) {
+        _writes[addr >> RECORD_LINE_BITS]++;
+        if(addr >= _dsLimit && addr < _dsLow) {
+            _dsLow = addr;
+        } else if(addr >= _rsLimit && addr < _rsLow) {
+            _rsLow = addr;
+        }
+    }
+};
+#endif
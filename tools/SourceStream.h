@@ -0,0 +1,139 @@
+#ifndef UKMAKER_SOURCE_STREAM_H
+#define UKMAKER_SOURCE_STREAM_H
+
+#include <stdlib.h>
+#include <string.h>
+#include "../runtime/ArduForth/Memory.h"
+
+/**
+ * An input source for TOKEN held on the host.
+ *
+ * Text comes from a refill callback into a buffer that grows to hold the
+ * longest line, so there is no line length limit. Lines are found in
+ * place and token() scans the current one as TOKEN scans the line buffer,
+ * copying only the token to the dictionary. A line is never copied into
+ * VM memory.
+ */
+
+#define SOURCE_BLOCK 65536
+
+// Fill buf with up to len bytes, @return 0 at the end of the source
+typedef size_t (*SourceRefill)(void *context, char *buf, size_t len);
+typedef void (*SourceClose)(void *context);
+
+class SourceStream {
+
+    public:
+
+    SourceStream() : _buf(NULL), _size(0), _refill(NULL), _close(NULL), _context(NULL) {}
+    ~SourceStream() {
+        close();
+        free(_buf);
+    }
+
+    void open(SourceRefill refill, SourceClose close, void *context) {
+        _refill = refill;
+        _close = close;
+        _context = context;
+        if(_buf == NULL) {
+            _size = SOURCE_BLOCK;
+            _buf = (char *)malloc(_size);
+        }
+        _fill = _next = _pos = _end = 0;
+        _eof = false;
+    }
+
+    void close() {
+        if(_close != NULL) {
+            _close(_context);
+        }
+        _refill = NULL;
+        _close = NULL;
+        _context = NULL;
+    }
+
+    /**
+     * Move on to the next line, @return false at the end of the source
+     */
+    bool nextLine() {
+        size_t start = _next;
+        size_t from = start;
+        while(true) {
+            const char *nl = (const char *)memchr(_buf + from, 0x0a, _fill - from);
+            if(nl != NULL) {
+                _setLine(start, nl - _buf, nl - _buf + 1);
+                return true;
+            }
+            if(_eof) {
+                if(start == _fill) {
+                    return false;
+                }
+                _setLine(start, _fill, _fill);
+                return true;
+            }
+            // Keep the partial line at the front, grow if it fills the buffer
+            memmove(_buf, _buf + start, _fill - start);
+            _fill -= start;
+            start = 0;
+            from = _fill;
+            if(_fill == _size) {
+                _size *= 2;
+                _buf = (char *)realloc(_buf, _size);
+            }
+            size_t n = _refill(_context, _buf + _fill, _size - _fill);
+            _eof = n == 0;
+            _fill += n;
+        }
+    }
+
+    /**
+     * TOKEN on the current line: the next token up to sep, leading seps
+     * skipped if sep is a space, stored as a string at dp
+     * @return the length, 0 if there is none
+     */
+    uint16_t token(Memory *mem, uint16_t dp, uint8_t sep) {
+        size_t p = _pos;
+        if(sep == ' ') {
+            while(p < _end && _buf[p] == ' ') {
+                p++;
+            }
+        }
+        size_t start = p;
+        while(p < _end && _buf[p] != (char)sep) {
+            p++;
+        }
+        uint16_t len = p - start;
+        if(len == 0) {
+            return 0;
+        }
+        mem->put(dp, len);
+        for(uint16_t i=0; i<len; i++) {
+            mem->putC(dp + 2 + i, _buf[start + i]);
+        }
+        _pos = p + 1; // Past the terminator
+        return len;
+    }
+
+    protected:
+
+    char *_buf;
+    size_t _size;  // Bytes allocated
+    size_t _fill;  // Bytes read into _buf
+    size_t _next;  // Start of the next line
+    size_t _pos;   // Scan position in the current line
+    size_t _end;   // End of the current line
+    bool _eof;
+    SourceRefill _refill;
+    SourceClose _close;
+    void *_context;
+
+    void _setLine(size_t start, size_t end, size_t next) {
+        if(end > start && _buf[end - 1] == 0x0d) {
+            end--;
+        }
+        _pos = start;
+        _end = end;
+        _next = next;
+    }
+};
+#endif
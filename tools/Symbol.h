@@ -8,7 +8,7 @@ class Symbol {
     public:
 
     const char *name;
-    Symbol *next;
+    Symbol *next = NULL;
     Token *token = NULL;
 
     bool resolved() {
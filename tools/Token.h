@@ -25,6 +25,15 @@
 #define DIRECTIVE_TYPE_RWORD_STRING 5 // Runtime only Forth word, Aligned flags.len string
 #define DIRECTIVE_TYPE_IWORD_STRING 6 // Immediate (compile-time only) Forth word, Aligned flags.len string
 #define DIRECTIVE_TYPE_XWORD_STRING 7 // Executive Forth word - has both compile-time and runtime behaviours, Aligned flags.len string
+#define DIRECTIVE_TYPE_TOKEN 8 // One byte thread token made by the assembler from .DATA, see TCOLON in core.fasm
+
+// Token codes, as #TOKEN_EXIT etc. in core.fasm
+#define THREAD_TOKEN_EXIT 0
+#define THREAD_TOKEN_ESCAPE 1
+#define THREAD_TOKEN_LIT 2
+#define THREAD_TOKEN_BRANCH 3
+#define THREAD_TOKEN_BRANCH0 4
+#define THREAD_TOKEN_FIRST 5
 
 /*
 Syntax:
@@ -102,6 +111,12 @@ class Token {
     // num16 may be a constant or the address of a variable or label
     bool symbolic = false;
 
+    // Placed in the separate header region, see Assembler::separateHeaders
+    bool header = false;
+
+    // The piece of the image this belongs to, see Assembler::shake
+    uint16_t segment = 0;
+
     Token *next = NULL;
     Token *label = NULL;
 
@@ -157,6 +172,15 @@ class Token {
         return isDirective() && (opcode == DIRECTIVE_TYPE_DATA);
     }
 
+    bool isThreadToken() {
+        return isDirective() && (opcode == DIRECTIVE_TYPE_TOKEN);
+    }
+
+    // Bytes taken by a thread token
+    uint8_t threadTokenSize() {
+        return (arga == THREAD_TOKEN_EXIT || arga >= THREAD_TOKEN_FIRST) ? 1 : 3;
+    }
+
     bool isStringData() {
         return isDirective() && (
             (opcode == DIRECTIVE_TYPE_PLAIN_STRING)
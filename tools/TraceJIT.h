@@ -0,0 +1,690 @@
+#ifndef UKMAKER_TRACE_JIT_H
+#define UKMAKER_TRACE_JIT_H
+
+#include <string.h>
+#include "../runtime/ArduForth/Memory.h"
+#include "../runtime/ArduForth/ForthVM.h"
+
+/**
+ * Tracing JIT for long runs on the host.
+ *
+ * The VM counts the jumps landing on each address and calls translate()
+ * once one gets hot. The code from there is decoded into a trace of
+ * pre-decoded operations, each a small function with its operands, so
+ * running it skips the fetch and decode and the dispatch through
+ * _clock. Unconditional jumps and calls are followed, so a primitive
+ * and the NEXT it ends with become one trace. A conditional jump back
+ * into the trace loops inside it; anything else leaves with PC set.
+ * Stack traps, halts and syscalls leave at once, as the interpreter
+ * would see them.
+ *
+ * The JIT is also the VM's Memory, wrapping the real one. Stores into a
+ * page holding translated code drop the traces on that page, and a trace
+ * that has just stored into its own code leaves before running stale
+ * operations.
+ */
+
+#define JIT_PAGE_BITS 6
+#define JIT_PAGES (0x10000 >> JIT_PAGE_BITS)
+#define JIT_MAX_OPS 64
+#define JIT_MAX_PAGES 8
+
+class TraceJIT;
+struct JitOp;
+
+// @return the index of the next operation, -1 once PC is set to leave
+typedef int16_t (*JitFn)(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i);
+
+struct JitOp {
+    JitFn fn;
+    uint8_t a;
+    uint8_t b;
+    int8_t n;       // the sign-extended short immediate
+    uint8_t cond;   // 0 always, else 1 + condition + 4 if inverted
+    uint16_t imm;   // the long immediate or the jump target
+    uint16_t next;  // PC after the instruction
+    int16_t jump;   // the target's index in the trace, -1 if outside
+};
+
+struct JitTrace {
+    uint16_t entry;
+    uint16_t count;
+    uint8_t numPages;
+    uint16_t pages[JIT_MAX_PAGES];
+    JitOp ops[JIT_MAX_OPS];
+    JitTrace *next;
+};
+
+class TraceJIT : public Memory, public ForthJit {
+
+    public:
+
+    TraceJIT(Memory *memory) :
+        Memory(NULL, 0, 0, NULL, 0, 0), _memory(memory)
+        {
+            _traces = NULL;
+            _retired = NULL;
+            _invalidated = false;
+            memset(_entries, 0, sizeof(_entries));
+            memset(_pageTraces, 0, sizeof(_pageTraces));
+            _translated = 0;
+            _invalidations = 0;
+            _entered = 0;
+        }
+
+    ~TraceJIT() {
+        clear();
+        _free();
+    }
+
+    // Drop every trace
+    void clear() {
+        while(_traces != NULL) {
+            _retire(_traces);
+        }
+        memset(_entries, 0, sizeof(_entries));
+    }
+
+    uint32_t translated() {
+        return _translated;
+    }
+
+    uint32_t invalidations() {
+        return _invalidations;
+    }
+
+    uint32_t entered() {
+        return _entered;
+    }
+
+    bool enter(ForthVM *vm, uint16_t addr) {
+        JitTrace *t = _entries[addr >> 1];
+        if(t == NULL || t == &_untranslatable || (addr & 1) != 0) {
+            return false;
+        }
+        _free();
+        _invalidated = false;
+        _entered++;
+        const JitOp *ops = t->ops;
+        int16_t i = 0;
+        while(i >= 0) {
+            i = ops[i].fn(this, vm, &ops[i], i);
+        }
+        return true;
+    }
+
+    void translate(ForthVM *, uint16_t addr) {
+        if((addr & 1) != 0 || _entries[addr >> 1] != NULL) {
+            return;
+        }
+        _free();
+        JitTrace *t = new JitTrace();
+        t->entry = addr;
+        t->count = 0;
+        t->numPages = 0;
+        if(!_record(t, addr)) {
+            delete t;
+            _entries[addr >> 1] = &_untranslatable;
+            return;
+        }
+        for(uint8_t p=0; p<t->numPages; p++) {
+            _pageTraces[t->pages[p]]++;
+        }
+        t->next = _traces;
+        _traces = t;
+        _entries[addr >> 1] = t;
+        _translated++;
+    }
+
+    void put(uint16_t addr, uint16_t w) {
+        _memory->put(addr, w);
+        _stored(addr, 2);
+    }
+
+    uint16_t get(uint16_t addr) {
+        return _memory->get(addr);
+    }
+
+    void putC(uint16_t addr, uint8_t c) {
+        _memory->putC(addr, c);
+        _stored(addr, 1);
+    }
+
+    uint8_t getC(uint16_t addr) {
+        return _memory->getC(addr);
+    }
+
+    uint8_t *addressOfChar(uint16_t location) {
+        return _memory->addressOfChar(location);
+    }
+
+    uint16_t *addressOfWord(uint16_t location) {
+        return _memory->addressOfWord(location);
+    }
+
+    // Keep bulk writes going through put and putC so they drop stale traces
+    bool inRam(uint16_t, uint16_t) {
+        return false;
+    }
+
+    uint32_t romCacheHits() {
+        return _memory->romCacheHits();
+    }
+
+    uint32_t romCacheMisses() {
+        return _memory->romCacheMisses();
+    }
+
+    protected:
+
+    Memory *_memory;
+
+    JitTrace *_traces;
+    JitTrace *_retired; // Dropped while perhaps running, freed later
+    JitTrace _untranslatable;
+    JitTrace *_entries[0x8000];
+    uint16_t _pageTraces[JIT_PAGES];
+    bool _invalidated;
+
+    uint32_t _translated;
+    uint32_t _invalidations;
+    uint32_t _entered;
+
+    void _stored(uint16_t addr, uint8_t n) {
+        uint16_t first = addr >> JIT_PAGE_BITS;
+        uint16_t last = (uint16_t)(addr + n - 1) >> JIT_PAGE_BITS;
+        if(_pageTraces[first] == 0 && _pageTraces[last] == 0) {
+            return;
+        }
+        JitTrace *t = _traces;
+        while(t != NULL) {
+            JitTrace *next = t->next;
+            for(uint8_t p=0; p<t->numPages; p++) {
+                if(t->pages[p] == first || t->pages[p] == last) {
+                    _retire(t);
+                    _invalidations++;
+                    _invalidated = true;
+                    break;
+                }
+            }
+            t = next;
+        }
+    }
+
+    void _retire(JitTrace *t) {
+        JitTrace **link = &_traces;
+        while(*link != t) {
+            link = &(*link)->next;
+        }
+        *link = t->next;
+        for(uint8_t p=0; p<t->numPages; p++) {
+            _pageTraces[t->pages[p]]--;
+        }
+        _entries[t->entry >> 1] = NULL;
+        t->next = _retired;
+        _retired = t;
+    }
+
+    void _free() {
+        while(_retired != NULL) {
+            JitTrace *t = _retired;
+            _retired = t->next;
+            delete t;
+        }
+    }
+
+    bool _addPage(JitTrace *t, uint16_t addr) {
+        uint16_t page = addr >> JIT_PAGE_BITS;
+        for(uint8_t p=0; p<t->numPages; p++) {
+            if(t->pages[p] == page) {
+                return true;
+            }
+        }
+        if(t->numPages == JIT_MAX_PAGES) {
+            return false;
+        }
+        t->pages[t->numPages++] = page;
+        return true;
+    }
+
+    // Where each address recorded so far runs from in the trace
+    struct JitMap {
+        uint16_t count;
+        uint16_t addr[2 * JIT_MAX_OPS];
+        int16_t index[2 * JIT_MAX_OPS];
+
+        void add(uint16_t a, int16_t i) {
+            addr[count] = a;
+            index[count++] = i;
+        }
+
+        int16_t find(uint16_t a) {
+            for(uint16_t i=0; i<count; i++) {
+                if(addr[i] == a) {
+                    return index[i];
+                }
+            }
+            return -1;
+        }
+    };
+
+    static int8_t _sex(uint8_t n, uint8_t b) {
+        return (n & (1 << b)) ? (int8_t)(n | ((0xff >> b) << b)) : (int8_t)n;
+    }
+
+    /**
+     * Decode from addr until the trace leaves or is full,
+     * @return false if nothing could be translated
+     */
+    bool _record(JitTrace *t, uint16_t addr) {
+        JitMap map;
+        map.count = 0;
+        uint16_t pc = addr;
+        bool open = true;
+        while(open) {
+            int16_t seen = map.find(pc);
+            if(seen != -1 || t->count == JIT_MAX_OPS - 1 || map.count == 2 * JIT_MAX_OPS - 1
+                || !_addPage(t, pc) || !_addPage(t, pc + 3)) {
+                // Close with a jump back into the trace or a way out
+                JitOp *op = &t->ops[t->count++];
+                op->fn = seen == -1 ? _leave : _goto;
+                op->imm = op->next = pc;
+                op->jump = seen;
+                break;
+            }
+            map.add(pc, t->count);
+            JitOp *op = &t->ops[t->count];
+            uint16_t instr = _memory->get(pc);
+            uint8_t code = (instr & OP_MASK) >> OP_BITS;
+            op->cond = 0;
+            if((instr & JP_OR_CALL_MASK) != 0) {
+                code = (instr & JP_OR_CALL_OP_MASK) >> OP_BITS;
+                if((instr & CC_APPLY_MASK) != 0) {
+                    op->cond = 1 + ((instr & CC_MASK) >> CC_BITS) + ((instr & CC_INV_MASK) != 0 ? 4 : 0);
+                }
+            }
+            op->a = (instr & ARGA_MASK) >> ARGA_BITS;
+            op->b = (instr & ARGB_MASK) >> ARGB_BITS;
+            op->n = _sex(op->b, 3);
+            op->next = pc + 2;
+            op->imm = 0;
+            op->jump = -1;
+            int8_t n8 = _sex((op->a << 4) + op->b, 7);
+            switch(code) {
+                case OP_MOVIL: case OP_STIL: case OP_ADDIL: case OP_SUBIL: case OP_CMPIL:
+                case OP_JP: case OP_JXL: case OP_CALL: case OP_CALLXL:
+                    op->imm = _memory->get(op->next);
+                    op->next += 2;
+                    break;
+                default:
+                    break;
+            }
+            op->fn = _select(code, op, n8, &open);
+            if(op->fn == NULL) {
+                // Not handled, the interpreter carries on from here
+                if(t->count == 0) {
+                    return false;
+                }
+                op->fn = _leave;
+                op->imm = op->next = pc;
+                t->count++;
+                break;
+            }
+            if(op->fn == _follow) {
+                // Nothing to run, the next operation comes from the target
+                pc = op->imm;
+                continue;
+            }
+            // A call pushes its return and carries on from the target
+            pc = op->fn == _call ? op->imm : op->next;
+            t->count++;
+        }
+        // Jumps inside the trace go straight to the operation
+        for(uint16_t i=0; i<t->count; i++) {
+            JitOp *op = &t->ops[i];
+            if(op->fn == _jump) {
+                op->jump = map.find(op->imm);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * The operation for an instruction, NULL if the interpreter has to
+     * run it. open goes false when the trace can't continue past it.
+     */
+    static JitFn _select(uint8_t code, JitOp *op, int8_t n8, bool *open) {
+        bool usesA = true;
+        bool usesB = false;
+        JitFn fn = NULL;
+        switch(code) {
+            case OP_NOP: return _nop;
+            case OP_MOV:
+                if(op->a == REG_PC) {
+                    *open = false;
+                    return op->b == REG_PC ? NULL : _movpc;
+                }
+                if(op->b == REG_PC) {
+                    op->imm = op->next;
+                    return _movil;
+                }
+                return _mov;
+            case OP_MOVI: op->imm = (uint16_t)op->n; fn = _movil; break;
+            case OP_MOVIL: fn = _movil; break;
+            case OP_MOVAI: op->a = REG_A; op->imm = (uint16_t)n8; fn = _movil; break;
+            case OP_MOVBI: op->a = REG_B; op->imm = (uint16_t)n8; fn = _movil; break;
+            case OP_LD: usesB = true; fn = _ld; break;
+            case OP_LD_B: usesB = true; fn = _ldb; break;
+            case OP_LDAX: op->b = REG_A; fn = _ldx; break;
+            case OP_LDBX: op->b = REG_B; fn = _ldx; break;
+            case OP_LDAX_B: op->b = REG_A; fn = _ldxb; break;
+            case OP_LDBX_B: op->b = REG_B; fn = _ldxb; break;
+            case OP_ST: usesB = true; fn = _st; break;
+            case OP_ST_B: usesB = true; fn = _stb; break;
+            case OP_STI: op->imm = (uint16_t)op->n; fn = _sti; break;
+            case OP_STAI: op->a = REG_A; op->imm = (uint16_t)n8; fn = _sti; break;
+            // As the interpreter does it
+            case OP_STBI: op->a = REG_B; op->imm = (uint8_t)n8; fn = _stib; break;
+            case OP_STIL: usesA = false; fn = _stil; break;
+            case OP_STI_B: op->imm = (uint8_t)op->n; fn = _stib; break;
+            case OP_STAI_B: op->a = REG_A; op->imm = (uint8_t)n8; fn = _stib; break;
+            case OP_STBI_B: op->a = REG_B; op->imm = (uint8_t)n8; fn = _stib; break;
+            case OP_STXA: op->b = REG_A; fn = _stx; break;
+            case OP_STXB: op->b = REG_B; fn = _stx; break;
+            case OP_STXA_B: op->b = REG_A; fn = _stxb; break;
+            case OP_STXB_B: op->b = REG_B; fn = _stxb; break;
+            case OP_PUSHD: fn = _pushd; break;
+            case OP_PUSHR: fn = _pushr; break;
+            case OP_POPD: fn = _popd; break;
+            case OP_POPR: fn = _popr; break;
+            case OP_ADD: usesB = true; fn = _add; break;
+            case OP_ADDI: fn = _addi; break;
+            case OP_ADDAI: op->a = REG_A; op->n = n8; fn = _addi; break;
+            case OP_ADDBI: op->a = REG_B; op->n = n8; fn = _addi; break;
+            case OP_ADDIL: fn = _addl; break;
+            case OP_CMP: usesB = true; fn = _cmp; break;
+            case OP_CMPI: op->imm = (uint8_t)op->n; fn = _cmpi; break;
+            case OP_CMPAI: op->a = REG_A; op->imm = (uint8_t)n8; fn = _cmpi; break;
+            case OP_CMPBI: op->a = REG_B; op->imm = (uint8_t)n8; fn = _cmpi; break;
+            case OP_CMPIL: fn = _cmpl; break;
+            case OP_SUB: usesB = true; fn = _sub; break;
+            case OP_SUBI: fn = _subi; break;
+            case OP_SUBAI: op->a = REG_A; op->n = n8; fn = _subi; break;
+            case OP_SUBBI: op->a = REG_B; op->n = n8; fn = _subi; break;
+            case OP_SUBIL: fn = _subl; break;
+            case OP_MUL: usesB = true; fn = _mul; break;
+            case OP_DIV: usesB = true; fn = _div; break;
+            case OP_AND: usesB = true; fn = _and; break;
+            case OP_OR: usesB = true; fn = _or; break;
+            case OP_NOT: fn = _not; break;
+            case OP_XOR: usesB = true; fn = _xor; break;
+            case OP_SLI: fn = _sli; break;
+            case OP_SRI: fn = _sri; break;
+            case OP_RLI: fn = _rli; break;
+            case OP_RRI: fn = _rri; break;
+            case OP_RLCI: fn = _rlci; break;
+            case OP_RRCI: fn = _rrci; break;
+            case OP_BITI: fn = _biti; break;
+            case OP_SETI: fn = _seti; break;
+            case OP_CLRI: fn = _clri; break;
+            case OP_SL: usesB = true; fn = _sl; break;
+            case OP_SR: usesB = true; fn = _sr; break;
+            case OP_RL: usesB = true; fn = _rl; break;
+            case OP_RR: usesB = true; fn = _rr; break;
+            case OP_RLC: usesB = true; fn = _rlc; break;
+            case OP_RRC: usesB = true; fn = _rrc; break;
+            case OP_BIT: usesB = true; fn = _bit; break;
+            case OP_SET: usesB = true; fn = _set; break;
+            case OP_CLR: usesB = true; fn = _clr; break;
+
+            case OP_JP:
+            case OP_JR:
+                if(code == OP_JR) {
+                    op->imm = op->next + (n8 << 1);
+                }
+                usesA = false;
+                fn = op->cond == 0 ? _follow : _jump;
+                break;
+            case OP_JX: op->imm = op->n << 1; fn = _jx; break;
+            case OP_JXL: fn = _jx; break;
+            case OP_CALL:
+            case OP_CALLR:
+                if(code == OP_CALLR) {
+                    op->imm = op->next + (n8 << 1);
+                }
+                usesA = false;
+                fn = op->cond == 0 ? _call : _callc;
+                break;
+            case OP_CALLX: op->imm = op->n << 1; fn = _callx; break;
+            case OP_CALLXL: fn = _callx; break;
+            case OP_RET: usesA = false; fn = _ret; break;
+            case OP_SYSCALL: usesA = false; op->imm = (uint16_t)n8; fn = _syscall; break;
+            case OP_HALT: usesA = false; fn = _halt; break;
+            default:
+                return NULL;
+        }
+        if((usesA && op->a == REG_PC) || (usesB && op->b == REG_PC)) {
+            return NULL;
+        }
+        if(fn == _jx || fn == _callx || fn == _callc || fn == _ret || fn == _halt) {
+            *open = fn == _callc;
+        }
+        return fn;
+    }
+
+    static bool _taken(ForthVM *vm, const JitOp *op) {
+        switch(op->cond) {
+            case 0: return true;
+            case 1 + COND_C: return vm->_c;
+            case 1 + COND_Z: return vm->_z;
+            case 1 + COND_M: return vm->_sign;
+            case 1 + COND_P: return vm->_odd;
+            case 5 + COND_C: return !vm->_c;
+            case 5 + COND_Z: return !vm->_z;
+            case 5 + COND_M: return !vm->_sign;
+            case 5 + COND_P: return !vm->_odd;
+            default: return true;
+        }
+    }
+
+    static int16_t _exit(ForthVM *vm, uint16_t pc) {
+        vm->_regs[REG_PC] = pc;
+        return -1;
+    }
+
+    // After anything that can trap or halt
+    static int16_t _checked(ForthVM *vm, const JitOp *op, int16_t i) {
+        return vm->_halted ? _exit(vm, op->next) : i + 1;
+    }
+
+    // After a store, which may have hit the code being run
+    static int16_t _written(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        return jit->_invalidated ? _exit(vm, op->next) : i + 1;
+    }
+
+    static int16_t _leave(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t) { return _exit(vm, op->imm); }
+    static int16_t _goto(TraceJIT *, ForthVM *, const JitOp *op, int16_t) { return op->jump; }
+    // Marks a jump followed while recording, never run
+    static int16_t _follow(TraceJIT *, ForthVM *, const JitOp *, int16_t i) { return i + 1; }
+    static int16_t _nop(TraceJIT *, ForthVM *, const JitOp *, int16_t i) { return i + 1; }
+
+    static int16_t _mov(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_regs[op->a] = vm->_regs[op->b];
+        return i + 1;
+    }
+
+    static int16_t _movpc(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t) {
+        return _exit(vm, vm->_regs[op->b]);
+    }
+
+    static int16_t _movil(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_regs[op->a] = op->imm;
+        return i + 1;
+    }
+
+    static int16_t _ld(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_regs[op->a] = vm->_get(vm->_regs[op->b]);
+        return i + 1;
+    }
+
+    static int16_t _ldb(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_regs[op->a] = vm->_getC(vm->_regs[op->b]);
+        return i + 1;
+    }
+
+    // LDAX and friends, b is the register loaded
+    static int16_t _ldx(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_regs[op->b] = vm->_get(vm->_regs[op->a] + (op->n << 1));
+        return i + 1;
+    }
+
+    static int16_t _ldxb(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_regs[op->b] = vm->_getC(vm->_regs[op->a] + (op->n << 1));
+        return i + 1;
+    }
+
+    static int16_t _st(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_put(vm->_regs[op->a], vm->_regs[op->b]);
+        return _written(jit, vm, op, i);
+    }
+
+    static int16_t _stb(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_putC(vm->_regs[op->a], vm->_regs[op->b]);
+        return _written(jit, vm, op, i);
+    }
+
+    static int16_t _sti(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_put(vm->_regs[op->a], op->imm);
+        return _written(jit, vm, op, i);
+    }
+
+    static int16_t _stib(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_putC(vm->_regs[op->a], op->imm);
+        return _written(jit, vm, op, i);
+    }
+
+    static int16_t _stil(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_put(op->a, op->imm);
+        return _written(jit, vm, op, i);
+    }
+
+    static int16_t _stx(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_put(vm->_regs[op->a] + (op->n << 1), vm->_regs[op->b]);
+        return _written(jit, vm, op, i);
+    }
+
+    static int16_t _stxb(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_putC(vm->_regs[op->a] + op->n, vm->_regs[op->b]);
+        return _written(jit, vm, op, i);
+    }
+
+    static int16_t _pushd(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_pushd(vm->_regs[op->a]);
+        return vm->_halted ? _exit(vm, op->next) : _written(jit, vm, op, i);
+    }
+
+    static int16_t _pushr(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_pushr(vm->_regs[op->a]);
+        return vm->_halted ? _exit(vm, op->next) : _written(jit, vm, op, i);
+    }
+
+    static int16_t _popd(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_regs[op->a] = vm->_popd();
+        return _checked(vm, op, i);
+    }
+
+    static int16_t _popr(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_regs[op->a] = vm->_popr();
+        return _checked(vm, op, i);
+    }
+
+    static int16_t _add(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_add(op->a, op->b); return i + 1; }
+    static int16_t _addi(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_addi(op->a, op->n); return i + 1; }
+    static int16_t _addl(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_addl(op->a, op->imm); return i + 1; }
+    static int16_t _cmp(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_cmp(op->a, op->b); return i + 1; }
+    static int16_t _cmpi(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_cmpi(op->a, op->imm); return i + 1; }
+    static int16_t _cmpl(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_cmpl(op->a, op->imm); return i + 1; }
+    static int16_t _sub(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_sub(op->a, op->b); return i + 1; }
+    static int16_t _subi(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_subi(op->a, op->n); return i + 1; }
+    static int16_t _subl(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_subl(op->a, op->imm); return i + 1; }
+    static int16_t _mul(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_mul(op->a, op->b); return i + 1; }
+    static int16_t _div(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_div(op->a, op->b); return i + 1; }
+    static int16_t _and(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_and(op->a, op->b); return i + 1; }
+    static int16_t _or(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_or(op->a, op->b); return i + 1; }
+    static int16_t _not(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_not(op->a); return i + 1; }
+    static int16_t _xor(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_xor(op->a, op->b); return i + 1; }
+    static int16_t _sli(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_sl(op->a, op->b); return i + 1; }
+    static int16_t _sri(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_sr(op->a, op->b); return i + 1; }
+    static int16_t _rli(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_rl(op->a, op->b); return i + 1; }
+    static int16_t _rri(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_rr(op->a, op->b); return i + 1; }
+    static int16_t _rlci(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_rlc(op->a, op->b); return i + 1; }
+    static int16_t _rrci(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_rrc(op->a, op->b); return i + 1; }
+    static int16_t _biti(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_bit(op->a, op->b); return i + 1; }
+    static int16_t _seti(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_set(op->a, op->b); return i + 1; }
+    static int16_t _clri(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_clr(op->a, op->b); return i + 1; }
+    static int16_t _sl(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_sl(op->a, vm->_regs[op->b]); return i + 1; }
+    static int16_t _sr(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_sr(op->a, vm->_regs[op->b]); return i + 1; }
+    static int16_t _rl(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_rl(op->a, vm->_regs[op->b]); return i + 1; }
+    static int16_t _rr(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_rr(op->a, vm->_regs[op->b]); return i + 1; }
+    static int16_t _rlc(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_rlc(op->a, vm->_regs[op->b]); return i + 1; }
+    static int16_t _rrc(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_rrc(op->a, vm->_regs[op->b]); return i + 1; }
+    static int16_t _bit(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_bit(op->a, vm->_regs[op->b]); return i + 1; }
+    static int16_t _set(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_set(op->a, vm->_regs[op->b]); return i + 1; }
+    static int16_t _clr(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) { vm->_clr(op->a, vm->_regs[op->b]); return i + 1; }
+
+    static int16_t _jump(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) {
+        if(!_taken(vm, op)) {
+            return i + 1;
+        }
+        return op->jump >= 0 ? op->jump : _exit(vm, op->imm);
+    }
+
+    static int16_t _jx(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t) {
+        if(!_taken(vm, op)) {
+            return _exit(vm, op->next);
+        }
+        return _exit(vm, vm->_regs[op->a] + op->imm);
+    }
+
+    // Followed into the target, which is the next operation
+    static int16_t _call(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        vm->_pushr(op->next);
+        return vm->_halted ? _exit(vm, op->imm) : _written(jit, vm, op, i);
+    }
+
+    static int16_t _callc(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t i) {
+        if(!_taken(vm, op)) {
+            return i + 1;
+        }
+        vm->_pushr(op->next);
+        return _exit(vm, op->imm);
+    }
+
+    static int16_t _callx(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t) {
+        if(!_taken(vm, op)) {
+            return _exit(vm, op->next);
+        }
+        vm->_pushr(op->next);
+        return _exit(vm, vm->_regs[op->a] + op->imm);
+    }
+
+    static int16_t _ret(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t) {
+        if(!_taken(vm, op)) {
+            return _exit(vm, op->next);
+        }
+        return _exit(vm, vm->_popr());
+    }
+
+    static int16_t _syscall(TraceJIT *jit, ForthVM *vm, const JitOp *op, int16_t i) {
+        // Syscalls may look at PC, e.g. syscall_unimplemented
+        vm->_regs[REG_PC] = op->next;
+        vm->syscall(op->imm);
+        return vm->_halted ? _exit(vm, op->next) : _written(jit, vm, op, i);
+    }
+
+    static int16_t _halt(TraceJIT *, ForthVM *vm, const JitOp *op, int16_t) {
+        vm->_halted = true;
+        return _exit(vm, op->next);
+    }
+};
+#endif
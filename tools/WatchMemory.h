@@ -0,0 +1,226 @@
+#ifndef UKMAKER_WATCH_MEMORY_H
+#define UKMAKER_WATCH_MEMORY_H
+
+#include <string.h>
+#include "../runtime/ArduForth/Memory.h"
+#include "../runtime/ArduForth/ForthVM.h"
+
+/**
+ * Data watchpoints for the host tools.
+ *
+ * Wraps another Memory and forwards every access to it. Stores are first
+ * checked against a bitmap with one bit per page so that unwatched memory
+ * costs a single bit test; only stores into a marked page are compared with
+ * the individual watch ranges.
+ *
+ * On a hit the old and new values are recorded and the callback, if any, is
+ * called. With haltOnHit() the VM is halted once the storing instruction
+ * completes, so ForthVM::run() returns at full speed; the Debugger also
+ * polls hit() after each step.
+ */
+
+#define WATCH_PAGE_BITS 6
+#define WATCH_PAGES (0x10000 >> WATCH_PAGE_BITS)
+#define WATCH_MAX 8
+
+using WatchHit = void (*)(uint16_t addr, uint16_t oldValue, uint16_t newValue);
+
+class WatchMemory : public Memory {
+
+    public:
+
+    WatchMemory(Memory *memory) :
+        Memory(NULL, 0, 0, NULL, 0, 0), _memory(memory)
+        {
+            clearWatches();
+            clearHit();
+            _onHit = NULL;
+            _vm = NULL;
+        }
+
+    ~WatchMemory() {}
+
+    /**
+     * Watch the bytes from start up to but not including end
+     */
+    bool watch(uint16_t start, uint16_t end) {
+        if(_numWatches == WATCH_MAX || end <= start) {
+            return false;
+        }
+        _watchStart[_numWatches] = start;
+        _watchEnd[_numWatches] = end;
+        _numWatches++;
+        _markPages();
+        return true;
+    }
+
+    bool unwatch(uint16_t start) {
+        for(uint8_t i=0; i<_numWatches; i++) {
+            if(_watchStart[i] == start) {
+                _numWatches--;
+                _watchStart[i] = _watchStart[_numWatches];
+                _watchEnd[i] = _watchEnd[_numWatches];
+                _markPages();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void clearWatches() {
+        _numWatches = 0;
+        memset(_pages, 0, sizeof(_pages));
+    }
+
+    void attachWatchCallback(WatchHit fp) {
+        _onHit = fp;
+    }
+
+    // Halt vm on a hit, NULL to only record it
+    void haltOnHit(ForthVM *vm) {
+        _vm = vm;
+    }
+
+    bool hit() {
+        return _hit;
+    }
+
+    void clearHit() {
+        _hit = false;
+        _hitAddress = 0;
+        _hitOld = 0;
+        _hitNew = 0;
+        _hitPC = 0;
+    }
+
+    uint16_t hitAddress() {
+        return _hitAddress;
+    }
+
+    uint16_t hitOldValue() {
+        return _hitOld;
+    }
+
+    uint16_t hitNewValue() {
+        return _hitNew;
+    }
+
+    // The VM's PC at the hit, past the storing instruction
+    uint16_t hitPC() {
+        return _hitPC;
+    }
+
+    void put(uint16_t addr, uint16_t w) {
+        if(_watched(addr, 2)) {
+            uint16_t old = _memory->get(addr);
+            _memory->put(addr, w);
+            _trigger(addr, old, w);
+        } else {
+            _memory->put(addr, w);
+        }
+    }
+
+    uint16_t get(uint16_t addr) {
+        return _memory->get(addr);
+    }
+
+    void putC(uint16_t addr, uint8_t c) {
+        if(_watched(addr, 1)) {
+            uint8_t old = _memory->getC(addr);
+            _memory->putC(addr, c);
+            _trigger(addr, old, c);
+        } else {
+            _memory->putC(addr, c);
+        }
+    }
+
+    uint8_t getC(uint16_t addr) {
+        return _memory->getC(addr);
+    }
+
+    uint8_t *addressOfChar(uint16_t location) {
+        return _memory->addressOfChar(location);
+    }
+
+    uint16_t *addressOfWord(uint16_t location) {
+        return _memory->addressOfWord(location);
+    }
+
+    bool inRam(uint16_t addr, uint16_t len) {
+        return _memory->inRam(addr, len);
+    }
+
+    uint32_t romCacheHits() {
+        return _memory->romCacheHits();
+    }
+
+    uint32_t romCacheMisses() {
+        return _memory->romCacheMisses();
+    }
+
+    protected:
+
+    Memory *_memory;
+
+    uint8_t _pages[WATCH_PAGES / 8];
+
+    uint8_t _numWatches;
+    uint16_t _watchStart[WATCH_MAX];
+    uint16_t _watchEnd[WATCH_MAX];
+
+    bool _hit;
+    uint16_t _hitAddress;
+    uint16_t _hitOld;
+    uint16_t _hitNew;
+    uint16_t _hitPC;
+    WatchHit _onHit;
+    ForthVM *_vm;
+
+    bool _pageBit(uint16_t addr) {
+        uint16_t page = addr >> WATCH_PAGE_BITS;
+        return (_pages[page >> 3] & (1 << (page & 7))) != 0;
+    }
+
+    bool _watched(uint16_t addr, uint8_t n) {
+        if(!_pageBit(addr) && !_pageBit(addr + n - 1)) {
+            return false;
+        }
+        for(uint8_t i=0; i<_numWatches; i++) {
+            if((addr + n) > _watchStart[i] && addr < _watchEnd[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void _markPages() {
+        memset(_pages, 0, sizeof(_pages));
+        for(uint8_t i=0; i<_numWatches; i++) {
+            uint16_t first = _watchStart[i] >> WATCH_PAGE_BITS;
+            uint16_t last = (_watchEnd[i] - 1) >> WATCH_PAGE_BITS;
+            for(uint16_t page = first; page <= last; page++) {
+                _pages[page >> 3] |= (1 << (page & 7));
+            }
+        }
+    }
+
+    void _trigger(uint16_t addr, uint16_t oldValue, uint16_t newValue) {
+        // keep the first hit until the debugger has reported it
+        if(!_hit) {
+            _hit = true;
+            _hitAddress = addr;
+            _hitOld = oldValue;
+            _hitNew = newValue;
+            if(_vm != NULL) {
+                _hitPC = _vm->get(REG_PC);
+            }
+        }
+        if(_onHit != NULL) {
+            _onHit(addr, oldValue, newValue);
+        }
+        if(_vm != NULL) {
+            _vm->halt();
+        }
+    }
+};
+#endif
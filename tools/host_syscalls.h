@@ -4,101 +4,294 @@
 #include "../runtime/ArduForth/FArduino.h"
 #include "../runtime/ArduForth/ForthVM.h"
 #include <stdio.h>
+#include <string.h>
+#include "SourceStream.h"
 
-#define SYSCALL_FOPEN 32
-#define SYSCALL_FCLOSE 33
-#define SYSCALL_FREAD 34
+// In the HOST_SYSCALLS range reserved by syscalls.h
+#define SYSCALL_FOPEN (CORE_SYSCALLS + 0)
+#define SYSCALL_FCLOSE (CORE_SYSCALLS + 1)
+#define SYSCALL_FREAD (CORE_SYSCALLS + 2)
+#define SYSCALL_FWRITE (CORE_SYSCALLS + 3)
+#define SYSCALL_FSEEK (CORE_SYSCALLS + 4)
+#define SYSCALL_SOURCE (CORE_SYSCALLS + 5)
+
+// Operations of SYSCALL_SOURCE
+#define SOURCE_OPEN 0
+#define SOURCE_LINE 1
+#define SOURCE_CLOSE 2
+#define SOURCE_TOKEN 3
 
 /**
  * Syscalls to be used during development
  * E.g. to allow loading of Forth source files for
  * compilation into a runtime image
+ *
+ * Files are held in a small table and named by handle, 1 to FILE_HANDLES.
+ * Handle 0 means the innermost file open for reading, the one FREAD
+ * takes lines from, so READ_FILE can nest: closing the inner file
+ * carries on with the outer one. For FWRITE, 0 means the file most
+ * recently opened for writing.
+ *
+ * Reads are done in FILE_BUFFER blocks and split into lines in memory.
 */
 
-static FILE *reader;
-static FILE *writer;
-// ( name-address type -- success )
-void syscall_fopen(ForthVM *vm) {
-    uint16_t type = vm->pop(); // 0 == read ; 1 = write
-    uint16_t fname = vm->pop(); // points to a Forth string
-    char *name = (char *)vm->ram()->addressOfChar(fname+2);
+#define FILE_HANDLES 8
+#define FILE_BUFFER 4096
+#define FILE_NAME_MAX 128
+#define FILE_LINE_MAX 64 // #LBUF_LEN in core.fasm
+
+#define SOURCE_DEPTH 8
+
+#define FILE_MODE_READ 0
+#define FILE_MODE_WRITE 1
+
+struct HostFile {
+    FILE *fp;
+    uint16_t mode;
+    uint32_t opened; // Order of opening, the highest reader is innermost
+    size_t pos;      // Next unread byte in buf
+    size_t end;      // End of the bytes read into buf
+    char buf[FILE_BUFFER];
+};
+
+static HostFile hostFiles[FILE_HANDLES];
+static uint32_t hostFilesOpened = 0;
+
+static HostFile *_host_file(uint16_t handle, uint16_t mode) {
+    if(handle > FILE_HANDLES) {
+        return NULL;
+    }
+    if(handle > 0) {
+        HostFile *f = &hostFiles[handle - 1];
+        return f->fp == NULL ? NULL : f;
+    }
+    HostFile *latest = NULL;
+    for(uint16_t i=0; i<FILE_HANDLES; i++) {
+        HostFile *f = &hostFiles[i];
+        if(f->fp != NULL && f->mode == mode && (latest == NULL || f->opened > latest->opened)) {
+            latest = f;
+        }
+    }
+    return latest;
+}
+
+// Copy the Forth string at fname to cname, false if it's too long
+static bool _host_file_name(ForthVM *vm, uint16_t fname, char *cname) {
     uint16_t len = vm->read(fname);
     len = len & 0x3fff; // Mask off the immediate/exec bits
-    char *cname;
-    cname = (char *)malloc(len+1);
+    if(len >= FILE_NAME_MAX) {
+        return false;
+    }
     for(uint16_t i=0; i<len; i++ ) {
         cname[i] = vm->readByte(fname + 2 + i);
     }
     cname[len] = '\0';
+    return true;
+}
 
-    const char *r = "r";
-    const char *w = "w";
-    bool success = true;
+// ( name-address mode -- handle ) handle is 0 if the file can't be opened
+void syscall_fopen(ForthVM *vm) {
+    uint16_t mode = vm->pop(); // 0 == read ; 1 = write
+    uint16_t fname = vm->pop(); // points to a Forth string
 
-    if(type == 0) {
-        reader = fopen(cname, r);
-        if(reader == NULL) success = false;
-    } else {
-        writer = fopen(cname, w);
-        if(writer == NULL) success = false;
+    uint16_t handle = 0;
+    while(handle < FILE_HANDLES && hostFiles[handle].fp != NULL) {
+        handle++;
+    }
+    char cname[FILE_NAME_MAX];
+    if(handle == FILE_HANDLES || !_host_file_name(vm, fname, cname)) {
+        vm->push(0);
+        return;
     }
 
-    vm->push(success ? 1 : 0);
-    free(cname);
+    HostFile *f = &hostFiles[handle];
+    f->fp = fopen(cname, mode == FILE_MODE_READ ? "r" : "w");
+    if(f->fp == NULL) {
+        vm->push(0);
+        return;
+    }
+    f->mode = mode;
+    f->opened = ++hostFilesOpened;
+    f->pos = f->end = 0;
+    vm->push(handle + 1);
 }
 
+// ( handle -- )
 void syscall_fclose(ForthVM *vm) {
-    uint16_t type = vm->pop();
-    if(type == 0) {
-        if(reader != NULL) fclose(reader);
-        reader = NULL;
-    } else {
-        if(writer != NULL) fclose(writer);
-        writer = NULL;
+    HostFile *f = _host_file(vm->pop(), FILE_MODE_READ);
+    if(f != NULL) {
+        fclose(f->fp);
+        f->fp = NULL;
     }
 }
 
 void syscall_fread(ForthVM *vm) {
     // ( bufferAddress -- bytesRead ) bytesRead is -1 if EOF is reached
-    
+    // Reads a line, or FILE_LINE_MAX bytes of one, from the innermost file
+
     // address of the buffer struct
     uint16_t buf = vm->pop();
     uint16_t bufidx = buf;
     uint16_t bufend = buf + 2;
     uint16_t bufstart = buf + 4;
-    uint8_t *cbuf = vm->ram()->addressOfChar(bufstart);
 
-    if(reader == NULL) {
+    HostFile *f = _host_file(0, FILE_MODE_READ);
+    if(f == NULL) {
         vm->push(-1);
         return;
     }
 
     uint16_t i = 0;
-    int c;
-    while( i < 128) {
-        c = fgetc(reader);
-        if(feof(reader)) {
-            if(i == 0) {
-                vm->push(-1);
-            } else {
-                vm->push(i);
+    bool newline = false;
+    while(i < FILE_LINE_MAX && !newline) {
+        if(f->pos == f->end) {
+            f->pos = 0;
+            f->end = fread(f->buf, 1, FILE_BUFFER, f->fp);
+            if(f->end == 0) {
+                break;
             }
-            return;
         }
-
-        *cbuf++ = c;
-        i++;
-        if(c == 0x0a) {
-            break;
+        const char *start = f->buf + f->pos;
+        size_t n = f->end - f->pos;
+        if(n > (size_t)(FILE_LINE_MAX - i)) {
+            n = FILE_LINE_MAX - i;
         }
+        const char *nl = (const char *)memchr(start, 0x0a, n);
+        if(nl != NULL) {
+            n = nl - start + 1;
+            newline = true;
+        }
+        if(vm->ram()->inRam(bufstart + i, n)) {
+            memcpy(vm->ram()->addressOfChar(bufstart + i), start, n);
+        } else {
+            for(size_t j=0; j<n; j++) {
+                vm->ram()->putC(bufstart + i + j, start[j]);
+            }
+        }
+        f->pos += n;
+        i += n;
     }
 
-    vm->ram()->put(bufend, bufstart + i - 1);
+    if(i == 0) {
+        vm->push(-1);
+        return;
+    }
+    uint16_t len = newline ? i - 1 : i;
+    vm->ram()->put(bufend, bufstart + len);
     // Current buffer pointer is just the start of the buffer
     vm->ram()->put(bufidx, bufstart);
     vm->push(i);
 }
 
+// ( address length handle -- written )
+void syscall_fwrite(ForthVM *vm) {
+    HostFile *f = _host_file(vm->pop(), FILE_MODE_WRITE);
+    uint16_t len = vm->pop();
+    uint16_t addr = vm->pop();
+    if(f == NULL || f->mode != FILE_MODE_WRITE) {
+        vm->push(0);
+        return;
+    }
+    size_t written;
+    if(vm->ram()->inRam(addr, len)) {
+        written = fwrite(vm->ram()->addressOfChar(addr), 1, len, f->fp);
+    } else {
+        written = 0;
+        while(written < len && fputc(vm->readByte(addr + written), f->fp) != EOF) {
+            written++;
+        }
+    }
+    vm->push(written);
+}
+
+// ( offset.d handle -- success ) Position from the start of the file
+void syscall_fseek(ForthVM *vm) {
+    HostFile *f = _host_file(vm->pop(), FILE_MODE_READ);
+    uint32_t hi = vm->pop();
+    uint32_t lo = vm->pop();
+    if(f == NULL) {
+        vm->push(0);
+        return;
+    }
+    // Drop whatever was read ahead
+    f->pos = f->end = 0;
+    vm->push(fseek(f->fp, (long)((hi << 16) | lo), SEEK_SET) == 0 ? 1 : 0);
+}
+
+
+// Nested host sources for STREAM_FILE, read by TOKEN while %SOURCE is set
+static SourceStream hostSources[SOURCE_DEPTH];
+static uint16_t hostSourceDepth = 0;
+
+static size_t _host_source_refill(void *context, char *buf, size_t len) {
+    return fread(buf, 1, len, (FILE *)context);
+}
+
+static void _host_source_close(void *context) {
+    fclose((FILE *)context);
+}
+
+// A restart clears %SOURCE, so drop the sources deeper than depth it left open
+void host_sources_drop(uint16_t depth) {
+    while(hostSourceDepth > depth) {
+        hostSources[--hostSourceDepth].close();
+    }
+}
 
+/**
+ * Add a source for TOKEN inside the others
+ * @return its depth, the new %SOURCE, or 0 if SOURCE_DEPTH are open
+ */
+uint16_t host_source_open(SourceRefill refill, SourceClose close, void *context) {
+    if(hostSourceDepth == SOURCE_DEPTH) {
+        return 0;
+    }
+    hostSources[hostSourceDepth].open(refill, close, context);
+    return ++hostSourceDepth;
+}
+
+// The innermost source, NULL if there is none
+SourceStream *host_source() {
+    return hostSourceDepth > 0 ? &hostSources[hostSourceDepth - 1] : NULL;
+}
+
+void syscall_source(ForthVM *vm) {
+    // ( ... op depth -- ... depth ) depth is %SOURCE before and after
+    uint16_t depth = vm->pop();
+    uint16_t op = vm->pop();
+    host_sources_drop(depth);
+    SourceStream *source = host_source();
+    switch(op) {
+        case SOURCE_OPEN: { // ( name -- success )
+            char cname[FILE_NAME_MAX];
+            FILE *fp = NULL;
+            if(_host_file_name(vm, vm->pop(), cname) && hostSourceDepth < SOURCE_DEPTH) {
+                fp = fopen(cname, "r");
+            }
+            if(fp != NULL) {
+                host_source_open(_host_source_refill, _host_source_close, fp);
+            }
+            vm->push(fp != NULL ? 1 : 0);
+            break;
+        }
+        case SOURCE_LINE: // ( -- more )
+            vm->push(source != NULL && source->nextLine() ? 1 : 0);
+            break;
+        case SOURCE_CLOSE: // ( -- )
+            if(source != NULL) {
+                source->close();
+                hostSourceDepth--;
+            }
+            break;
+        case SOURCE_TOKEN: { // ( sep dp -- len )
+            uint16_t dp = vm->pop();
+            uint16_t sep = vm->pop();
+            vm->push(source != NULL ? source->token(vm->ram(), dp, sep) : 0);
+            break;
+        }
+        default: break;
+    }
+    vm->push(hostSourceDepth);
+}
 
-#endif
\ No newline at end of file
+#endif